@@ -0,0 +1,270 @@
+#ifndef S21_POOL_ALLOCATOR_H_
+#define S21_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Fixed-size block arena. Blocks are carved out of slabs that double in size
+// up to kMaxSlabBlocks; freed blocks go to an intrusive free list and are
+// handed out again before the current slab is touched. Slabs are returned to
+// the system only by Release() or the destructor.
+class NodePool {
+ public:
+  NodePool(size_t block_size, size_t block_align)
+      : block_size_(RoundUp(block_size < sizeof(FreeBlock) ? sizeof(FreeBlock)
+                                                           : block_size,
+                            block_align)),
+        free_list_(nullptr),
+        next_(nullptr),
+        end_(nullptr),
+        slabs_(nullptr),
+        slab_blocks_(kMinSlabBlocks),
+        in_use_(0) {}
+
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+
+  ~NodePool() { Release(); }
+
+  void *Allocate() {
+    void *block;
+    if (free_list_ != nullptr) {
+      block = free_list_;
+      free_list_ = free_list_->next;
+    } else {
+      if (next_ == end_) {
+        AddSlab();
+      }
+      block = next_;
+      next_ += block_size_;
+    }
+    ++in_use_;
+    return block;
+  }
+
+  void Deallocate(void *block) noexcept {
+    FreeBlock *free_block = static_cast<FreeBlock *>(block);
+    free_block->next = free_list_;
+    free_list_ = free_block;
+    --in_use_;
+  }
+
+  // Frees every slab at once. Only valid when no block is in use.
+  void Release() noexcept {
+    while (slabs_ != nullptr) {
+      Slab *next = slabs_->next;
+      ::operator delete(slabs_);
+      slabs_ = next;
+    }
+    free_list_ = nullptr;
+    next_ = nullptr;
+    end_ = nullptr;
+    slab_blocks_ = kMinSlabBlocks;
+    in_use_ = 0;
+  }
+
+  size_t block_size() const noexcept { return block_size_; }
+  size_t in_use() const noexcept { return in_use_; }
+
+ private:
+  static constexpr size_t kMinSlabBlocks = 32;
+  static constexpr size_t kMaxSlabBlocks = 4096;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct Slab {
+    Slab *next;
+  };
+
+  static constexpr size_t kSlabHeader =
+      (sizeof(Slab) + alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  size_t block_size_;
+  FreeBlock *free_list_;
+  char *next_;
+  char *end_;
+  Slab *slabs_;
+  size_t slab_blocks_;
+  size_t in_use_;
+
+  static size_t RoundUp(size_t size, size_t align) {
+    return (size + align - 1) / align * align;
+  }
+
+  void AddSlab() {
+    char *memory = static_cast<char *>(
+        ::operator new(kSlabHeader + slab_blocks_ * block_size_));
+    Slab *slab = reinterpret_cast<Slab *>(memory);
+    slab->next = slabs_;
+    slabs_ = slab;
+    next_ = memory + kSlabHeader;
+    end_ = next_ + slab_blocks_ * block_size_;
+    if (slab_blocks_ < kMaxSlabBlocks) {
+      slab_blocks_ *= 2;
+    }
+  }
+};
+
+// The pools behind one PoolAllocator and all of its copies and rebinds, one
+// pool per block size and alignment. Sharing the set is what makes a rebound
+// allocator compare equal to its source, so two containers built from one
+// allocator can hand nodes to each other.
+class NodePoolSet {
+ public:
+  NodePoolSet() = default;
+  NodePoolSet(const NodePoolSet &) = delete;
+  NodePoolSet &operator=(const NodePoolSet &) = delete;
+
+  // Returns the pool for blocks of this size, creating it on first use.
+  NodePool &Get(size_t block_size, size_t block_align) {
+    NodePool *pool = Find(block_size, block_align);
+    if (pool == nullptr) {
+      pools_.push_back(
+          {block_size, block_align,
+           std::make_unique<NodePool>(block_size, block_align)});
+      pool = pools_.back().pool.get();
+    }
+    return *pool;
+  }
+
+  NodePool *Find(size_t block_size, size_t block_align) const noexcept {
+    for (const Entry &entry : pools_) {
+      if (entry.block_size == block_size && entry.block_align == block_align) {
+        return entry.pool.get();
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  struct Entry {
+    size_t block_size;
+    size_t block_align;
+    std::unique_ptr<NodePool> pool;
+  };
+
+  std::vector<Entry> pools_;
+};
+
+// Allocator handing out single objects from a NodePool, meant to be passed as
+// the Alloc parameter of the node containers (list, Map, Set, Multiset). A
+// default-constructed allocator creates its pool set at once; copies and
+// rebinds share it, and a rebind looks up the pool for its own block size on
+// its first allocation. Allocators compare equal when they share a set, so
+// containers built from one allocator splice and merge by relinking nodes.
+// Requests for more than one object bypass the pool.
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = PoolAllocator<U>;
+  };
+
+  PoolAllocator()
+      : pools_(std::make_shared<NodePoolSet>()),
+        pool_(&pools_->Get(sizeof(T), alignof(T))) {}
+  // no move operations: a moved-from allocator must still free its blocks
+  PoolAllocator(const PoolAllocator &other) noexcept = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &other) noexcept
+      : pools_(other.pools_), pool_(pools_->Find(sizeof(T), alignof(T))) {}
+
+  PoolAllocator &operator=(const PoolAllocator &other) noexcept = default;
+
+  T *allocate(size_type n) {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    if (pool_ == nullptr) {
+      pool_ = &pools_->Get(sizeof(T), alignof(T));
+    }
+    return static_cast<T *>(pool_->Allocate());
+  }
+
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n != 1) {
+      std::allocator<T>().deallocate(ptr, n);
+      return;
+    }
+    if (pool_ == nullptr) {
+      // a copy taken before the first allocation; the block's pool exists
+      pool_ = pools_->Find(sizeof(T), alignof(T));
+    }
+    pool_->Deallocate(ptr);
+  }
+
+  // Returns all slabs to the system; called by the containers after clear().
+  // The pool is shared, so it is released only once no container uses it.
+  void release() noexcept {
+    NodePool *pool = Pool();
+    if (pool != nullptr && pool->in_use() == 0) {
+      pool->Release();
+    }
+  }
+
+  size_type max_size() const noexcept {
+    return std::allocator_traits<std::allocator<T>>::max_size(
+        std::allocator<T>());
+  }
+
+  // The pool for T, or nullptr if no copy has allocated a T yet.
+  const NodePool *pool() const noexcept { return Pool(); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> &other) const noexcept {
+    return pools_ == other.pools_;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U> &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  template <typename>
+  friend class PoolAllocator;
+
+  std::shared_ptr<NodePoolSet> pools_;
+  NodePool *pool_;
+
+  NodePool *Pool() const noexcept {
+    return pool_ != nullptr ? pool_ : pools_->Find(sizeof(T), alignof(T));
+  }
+};
+
+// Calls alloc.release() for allocators that have one, so that containers can
+// hand their arena back in bulk after destroying every node.
+template <typename Alloc, typename = void>
+struct HasRelease : std::false_type {};
+
+template <typename Alloc>
+struct HasRelease<Alloc,
+                  std::void_t<decltype(std::declval<Alloc &>().release())>>
+    : std::true_type {};
+
+template <typename Alloc>
+void ReleaseNodes(Alloc &alloc) noexcept {
+  if constexpr (HasRelease<Alloc>::value) {
+    alloc.release();
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_POOL_ALLOCATOR_H_
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+TEST(NodePoolTest, ReusesFreedBlock) {
+  s21::NodePool pool(sizeof(int), alignof(int));
+  void *first = pool.Allocate();
+  pool.Allocate();
+  EXPECT_EQ(pool.in_use(), 2u);
+  pool.Deallocate(first);
+  EXPECT_EQ(pool.in_use(), 1u);
+  EXPECT_EQ(pool.Allocate(), first);
+}
+
+TEST(NodePoolTest, BlocksDoNotOverlap) {
+  s21::NodePool pool(sizeof(double), alignof(double));
+  std::vector<double *> blocks;
+  for (int i = 0; i < 1000; ++i) {
+    double *block = static_cast<double *>(pool.Allocate());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(double), 0u);
+    *block = i;
+    blocks.push_back(block);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(*blocks[i], i);
+  }
+  for (double *block : blocks) {
+    pool.Deallocate(block);
+  }
+  EXPECT_EQ(pool.in_use(), 0u);
+}
+
+TEST(NodePoolTest, SmallBlocksHoldFreeListLink) {
+  s21::NodePool pool(1, 1);
+  EXPECT_GE(pool.block_size(), sizeof(void *));
+}
+
+TEST(NodePoolTest, Release) {
+  s21::NodePool pool(sizeof(int), alignof(int));
+  for (int i = 0; i < 100; ++i) {
+    pool.Deallocate(pool.Allocate());
+  }
+  pool.Release();
+  EXPECT_EQ(pool.in_use(), 0u);
+  int *block = static_cast<int *>(pool.Allocate());
+  *block = 21;
+  EXPECT_EQ(*block, 21);
+  pool.Deallocate(block);
+}
+
+TEST(PoolAllocatorTest, CopiesSharePool) {
+  s21::PoolAllocator<int> alloc;
+  int *ptr = alloc.allocate(1);
+  s21::PoolAllocator<int> copy(alloc);
+  EXPECT_TRUE(copy == alloc);
+  EXPECT_EQ(copy.pool(), alloc.pool());
+  copy.deallocate(ptr, 1);
+  EXPECT_EQ(alloc.pool()->in_use(), 0u);
+}
+
+TEST(PoolAllocatorTest, ReboundAllocatorSharesPoolSet) {
+  s21::PoolAllocator<int> alloc;
+  alloc.deallocate(alloc.allocate(1), 1);
+  s21::PoolAllocator<std::string> rebound(alloc);
+  s21::PoolAllocator<std::string> early(rebound);
+  EXPECT_EQ(rebound.pool(), nullptr);
+  EXPECT_TRUE(rebound == alloc);
+  std::string *ptr = rebound.allocate(1);
+  EXPECT_EQ(rebound.pool()->in_use(), 1u);
+  EXPECT_EQ(alloc.pool()->in_use(), 0u);
+  // rebinding back finds the pool of the source
+  s21::PoolAllocator<int> back(rebound);
+  EXPECT_EQ(back.pool(), alloc.pool());
+  // a copy taken before the first allocation frees into the later pool
+  early.deallocate(ptr, 1);
+  EXPECT_EQ(rebound.pool()->in_use(), 0u);
+  EXPECT_TRUE(s21::PoolAllocator<int>() != alloc);
+}
+
+TEST(PoolAllocatorTest, ArraysBypassPool) {
+  s21::PoolAllocator<int> alloc;
+  int *array = alloc.allocate(10);
+  for (int i = 0; i < 10; ++i) {
+    array[i] = i;
+  }
+  EXPECT_EQ(array[9], 9);
+  EXPECT_EQ(alloc.pool()->in_use(), 0u);
+  alloc.deallocate(array, 10);
+}
+
+TEST(PoolAllocatorTest, ReleaseKeepsPoolInUse) {
+  s21::PoolAllocator<int> alloc;
+  int *ptr = alloc.allocate(1);
+  alloc.release();
+  EXPECT_EQ(alloc.pool()->in_use(), 1u);
+  alloc.deallocate(ptr, 1);
+  alloc.release();
+  EXPECT_EQ(alloc.pool()->in_use(), 0u);
+}
+
+TEST(PoolAllocatorTest, MapInsertEraseIterate) {
+  s21::Map<int, std::string, std::less<int>,
+           s21::PoolAllocator<std::string>>
+      map;
+  for (int i = 1; i <= 1000; ++i) {
+    map.insert(i, std::to_string(i));
+  }
+  for (int i = 1; i <= 1000; i += 2) {
+    map.erase(map.find(i));
+  }
+  EXPECT_EQ(map.size(), 500u);
+  int expected = 2;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ((*it).first, expected);
+    EXPECT_EQ(it->second, std::to_string(expected));
+    expected += 2;
+  }
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  map.insert(7, "seven");
+  EXPECT_EQ(map.at(7), "seven");
+}
+
+TEST(PoolAllocatorTest, MapCopyMoveSwap) {
+  using PoolMap =
+      s21::Map<int, int, std::less<int>, s21::PoolAllocator<int>>;
+  PoolMap map{{1, 10}, {2, 20}, {3, 30}};
+  PoolMap copy(map);
+  PoolMap moved(std::move(map));
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_EQ(moved.size(), 3u);
+  PoolMap other{{4, 40}};
+  moved.swap(other);
+  EXPECT_EQ(moved.at(4), 40);
+  EXPECT_EQ(other.at(2), 20);
+  copy = std::move(other);
+  EXPECT_EQ(copy.at(3), 30);
+}
+
+TEST(PoolAllocatorTest, SetWithPool) {
+  s21::Set<int, s21::PoolAllocator<int>> set{5, 3, 8, 1};
+  set.insert(4);
+  set.erase(3);
+  s21::Set<int, s21::PoolAllocator<int>> copy(set);
+  s21::Set<int, s21::PoolAllocator<int>> moved(std::move(set));
+  std::vector<int> keys;
+  for (auto it = moved.begin(); it != moved.end(); ++it) {
+    keys.push_back(*it);
+  }
+  EXPECT_EQ(keys, (std::vector<int>{1, 4, 5, 8}));
+  EXPECT_EQ(copy.size(), 4u);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  copy.insert(2);
+  EXPECT_TRUE(copy.contains(2));
+}
+
+TEST(PoolAllocatorTest, MultisetWithPool) {
+  s21::Multiset<int, s21::PoolAllocator<int>> multiset{2, 1, 2, 3, 2};
+  EXPECT_EQ(multiset.count(2), 3u);
+  multiset.insert(4);
+  multiset.erase(2);
+  EXPECT_EQ(multiset.count(2), 0u);
+  s21::Multiset<int, s21::PoolAllocator<int>> moved(std::move(multiset));
+  std::vector<int> keys;
+  for (auto it = moved.begin(); it != moved.end(); ++it) {
+    keys.push_back(*it);
+  }
+  EXPECT_EQ(keys, (std::vector<int>{1, 3, 4}));
+}
@@ -0,0 +1,40 @@
+#ifndef S21_BENCH_H_
+#define S21_BENCH_H_
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace s21_bench {
+
+constexpr int64_t kMinSize = 100;
+constexpr int64_t kMaxSize = 10'000'000;
+constexpr unsigned kSeed = 21;
+
+// 1e2, 1e3, ..., 1e7 elements
+inline void AllSizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)
+      ->Range(kMinSize, kMaxSize)
+      ->Unit(benchmark::kMicrosecond);
+}
+
+// Keys 1..n in a fixed pseudo-random order. Zero is skipped on purpose:
+// the end() sentinel of s21::Map carries a value-initialized key.
+inline std::vector<int> ShuffledKeys(int64_t n) {
+  std::vector<int> keys(static_cast<size_t>(n));
+  std::iota(keys.begin(), keys.end(), 1);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(kSeed));
+  return keys;
+}
+
+inline void SetItems(benchmark::State &state) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_BENCH_H_
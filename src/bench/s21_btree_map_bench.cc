@@ -0,0 +1,92 @@
+#include <map>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using S21BTreeMap = s21::BTreeMap<int, int>;
+using S21TreeMap = s21::Map<int, int>;
+using StdOrderedMap = std::map<int, int>;
+
+namespace {
+
+template <typename Container>
+Container Filled(const std::vector<int> &keys) {
+  Container m;
+  for (int key : keys) {
+    m.insert({key, key});
+  }
+  return m;
+}
+
+template <typename Container>
+void BM_OrderedInsert(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    Container m;
+    for (int key : keys) {
+      m.insert({key, key});
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+// every key once, in random order: one root-to-leaf walk per lookup
+template <typename Container>
+void BM_OrderedFind(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  Container m = Filled<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += m.find(key) != m.end();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_OrderedScan(benchmark::State &state) {
+  Container m = Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      sum += (*it).second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_OrderedErase(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container m = Filled<Container>(keys);
+    state.ResumeTiming();
+    for (int key : keys) {
+      m.erase(m.find(key));
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_OrderedInsert, S21BTreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedInsert, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedInsert, StdOrderedMap)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedFind, S21BTreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedFind, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedFind, StdOrderedMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedScan, S21BTreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedScan, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedScan, StdOrderedMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedErase, S21BTreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedErase, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_OrderedErase, StdOrderedMap)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,125 @@
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+
+// The LRU cache as it used to be written by hand: an s21::list of entries
+// and an s21::Map from key to list node. s21::list had no single-node
+// splice, so a hit erases the node and pushes a new one to the front.
+class MapListLru {
+ public:
+  explicit MapListLru(size_t capacity) : capacity_(capacity) {}
+
+  int *get(int key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return nullptr;
+    }
+    std::pair<int, int> entry = *(*found).second;
+    entries_.erase((*found).second);
+    entries_.push_front(entry);
+    (*found).second = entries_.begin();
+    return &(*entries_.begin()).second;
+  }
+
+  void put(int key, int value) {
+    if (entries_.size() == capacity_) {
+      index_.erase(index_.find(entries_.back().first));
+      entries_.pop_back();
+    }
+    entries_.push_front({key, value});
+    index_.insert(key, entries_.begin());
+  }
+
+ private:
+  using List = s21::list<std::pair<int, int>>;
+
+  size_t capacity_;
+  List entries_;
+  s21::Map<int, List::iterator> index_;
+};
+
+// The same with std::list::splice and std::unordered_map.
+class StdLru {
+ public:
+  explicit StdLru(size_t capacity) : capacity_(capacity) {}
+
+  int *get(int key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return &found->second->second;
+  }
+
+  void put(int key, int value) {
+    if (entries_.size() == capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, value);
+    index_.emplace(key, entries_.begin());
+  }
+
+ private:
+  using List = std::list<std::pair<int, int>>;
+
+  size_t capacity_;
+  List entries_;
+  std::unordered_map<int, List::iterator> index_;
+};
+
+using S21Lru = s21::LruCache<int, int>;
+using S21Lfu = s21::LfuCache<int, int>;
+
+// Cache sizes 1e3 .. 1e6; every size runs the same number of lookups.
+void CacheSizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(1000, 1'000'000)->Unit(benchmark::kMicrosecond);
+}
+
+constexpr int64_t kLookups = 1'000'000;
+
+// Keys drawn from twice the capacity, so about half the lookups miss; a
+// miss is followed by a put, which evicts once the cache is full.
+template <typename Cache>
+void BM_CacheGetOrPut(benchmark::State &state) {
+  const int64_t capacity = state.range(0);
+  std::mt19937 rng(s21_bench::kSeed);
+  std::uniform_int_distribution<int> key(0, static_cast<int>(2 * capacity));
+  std::vector<int> keys(kLookups);
+  for (int &k : keys) {
+    k = key(rng);
+  }
+  Cache cache(static_cast<size_t>(capacity));
+  for (int k : keys) {
+    if (cache.get(k) == nullptr) {
+      cache.put(k, k);
+    }
+  }
+  for (auto _ : state) {
+    int64_t hits = 0;
+    for (int k : keys) {
+      int *value = cache.get(k);
+      if (value != nullptr) {
+        ++hits;
+      } else {
+        cache.put(k, k);
+      }
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * kLookups);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_CacheGetOrPut, S21Lru)->Apply(CacheSizes);
+BENCHMARK_TEMPLATE(BM_CacheGetOrPut, S21Lfu)->Apply(CacheSizes);
+BENCHMARK_TEMPLATE(BM_CacheGetOrPut, MapListLru)->Apply(CacheSizes);
+BENCHMARK_TEMPLATE(BM_CacheGetOrPut, StdLru)->Apply(CacheSizes);
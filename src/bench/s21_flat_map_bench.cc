@@ -0,0 +1,91 @@
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using S21FlatMap = s21::FlatMap<int, int>;
+using S21TreeMap = s21::Map<int, int>;
+using StdTreeMap = std::map<int, int>;
+
+namespace {
+
+std::vector<std::pair<int, int>> Items(const std::vector<int> &keys) {
+  std::vector<std::pair<int, int>> items;
+  items.reserve(keys.size());
+  for (int key : keys) {
+    items.push_back({key, key});
+  }
+  return items;
+}
+
+template <typename Container>
+Container Built(const std::vector<int> &keys) {
+  if constexpr (std::is_same_v<Container, S21FlatMap>) {
+    auto items = Items(keys);
+    return Container(items.begin(), items.end());
+  } else {
+    Container m;
+    for (int key : keys) {
+      m.insert({key, key});
+    }
+    return m;
+  }
+}
+
+// one-off construction from shuffled keys: a sort for FlatMap, n tree
+// insertions otherwise
+template <typename Container>
+void BM_FlatBuild(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    Container m = Built<Container>(keys);
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+// every key once, in shuffled order, half of them absent
+template <typename Container>
+void BM_FlatLookup(benchmark::State &state) {
+  const int64_t n = state.range(0);
+  const auto keys = s21_bench::ShuffledKeys(n);
+  Container m = Built<Container>(keys);
+  std::vector<int> probes(keys);
+  for (size_t i = 0; i < probes.size(); i += 2) {
+    probes[i] += static_cast<int>(n);
+  }
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : probes) {
+      found += m.find(key) != m.end();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_FlatIterate(benchmark::State &state) {
+  Container m = Built<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      sum += (*it).second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FlatBuild, S21FlatMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatBuild, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatLookup, S21FlatMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatLookup, S21TreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatLookup, StdTreeMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatIterate, S21FlatMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_FlatIterate, S21TreeMap)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,219 @@
+#include <list>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using S21List = s21::list<int>;
+using S21PoolList = s21::list<int, s21::PoolAllocator<int>>;
+using StdList = std::list<int>;
+
+// an object with some payload, living in an arena and tracked by a list
+struct Tracked : s21::IntrusiveListHook<> {
+  explicit Tracked(int64_t i) : id(i), payload{} {}
+  int64_t id;
+  char payload[48];
+};
+
+using S21TrackedList = s21::list<Tracked>;
+using S21IntrusiveList = s21::IntrusiveList<Tracked>;
+using StdTrackedList = std::list<Tracked>;
+
+namespace {
+
+template <typename Container>
+Container Filled(int64_t n) {
+  Container l;
+  for (int64_t i = 0; i < n; ++i) {
+    l.push_back(static_cast<int>(i));
+  }
+  return l;
+}
+
+// s21::list::end() points at the last node rather than past it.
+long long Sum(S21List &l) {
+  long long sum = 0;
+  for (auto it = l.begin(), last = ++l.end(); it != last; ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+long long Sum(StdList &l) {
+  long long sum = 0;
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+template <typename Container>
+void BM_ListPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    Container l;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      l.push_back(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(l.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_ListPushFront(benchmark::State &state) {
+  for (auto _ : state) {
+    Container l;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      l.push_front(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(l.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_ListErase(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container l = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    while (!l.empty()) {
+      l.erase(l.begin());
+    }
+    benchmark::DoNotOptimize(l.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_ListIterate(benchmark::State &state) {
+  Container l = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Sum(l));
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_ListCopy(benchmark::State &state) {
+  const Container l = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container copy(l);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_ListMove(benchmark::State &state) {
+  Container l = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container moved(std::move(l));
+    benchmark::DoNotOptimize(moved.size());
+    l.swap(moved);
+  }
+}
+
+template <typename Container>
+void BM_ListSort(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container l;
+    for (int key : keys) {
+      l.push_back(key);
+    }
+    state.ResumeTiming();
+    l.sort();
+    benchmark::DoNotOptimize(l.front());
+  }
+  s21_bench::SetItems(state);
+  state.SetComplexityN(state.range(0));
+}
+
+// An LRU-style workload: the list keeps its length while every step adds a
+// node at the front and drops one at the back.
+template <typename Container>
+void BM_ListChurn(benchmark::State &state) {
+  Container l = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      l.push_front(static_cast<int>(i));
+      l.pop_back();
+    }
+    benchmark::DoNotOptimize(l.front());
+  }
+  s21_bench::SetItems(state);
+}
+
+// Links every arena object into the list and unlinks them again: a copy
+// into a new node and a free for s21::list and std::list, two pointer
+// writes each way for IntrusiveList.
+template <typename Container>
+void BM_ListTrack(benchmark::State &state) {
+  std::vector<Tracked> arena;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    arena.emplace_back(i);
+  }
+  for (auto _ : state) {
+    Container l;
+    for (Tracked &object : arena) {
+      l.push_back(object);
+    }
+    benchmark::DoNotOptimize(l.size());
+    while (!l.empty()) {
+      l.pop_front();
+    }
+  }
+  s21_bench::SetItems(state);
+}
+
+// Merges the even and the odd numbers below n, each list already sorted.
+template <typename Container>
+void BM_ListMerge(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container evens;
+    Container odds;
+    for (int64_t i = 0; i < state.range(0); i += 2) {
+      evens.push_back(static_cast<int>(i));
+      odds.push_back(static_cast<int>(i + 1));
+    }
+    state.ResumeTiming();
+    evens.merge(odds);
+    benchmark::DoNotOptimize(evens.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ListPushBack, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListPushBack, S21PoolList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListPushBack, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListPushFront, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListPushFront, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListErase, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListErase, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListIterate, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListIterate, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListCopy, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListCopy, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListMove, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListMove, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListSort, S21List)
+    ->Apply(s21_bench::AllSizes)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_ListSort, StdList)
+    ->Apply(s21_bench::AllSizes)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_ListChurn, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListChurn, S21PoolList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListChurn, StdList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListTrack, S21TrackedList)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListTrack, S21IntrusiveList)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListTrack, StdTrackedList)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListMerge, S21List)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_ListMerge, StdList)->Apply(s21_bench::AllSizes);
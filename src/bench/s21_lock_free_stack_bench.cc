@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr int kPreloaded = 1024;
+constexpr int kOpsPerIteration = 1000;
+
+// Stack<int> behind one mutex.
+class MutexStack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) {
+      return false;
+    }
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  Stack<int> stack_;
+};
+
+// Free-list pattern: every thread repeatedly takes a value and puts it back.
+// The stack is shared by all threads of one run and filled by thread 0.
+template <typename Container>
+void BM_StackSharedFreeList(benchmark::State &state) {
+  static Container *stack = nullptr;
+  if (state.thread_index() == 0) {
+    stack = new Container;
+    for (int i = 0; i < kPreloaded; ++i) {
+      stack->push(i);
+    }
+  }
+  for (auto _ : state) {
+    for (int i = 0; i < kOpsPerIteration; ++i) {
+      int value = i;
+      if (stack->try_pop(value)) {
+        stack->push(value);
+      }
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete stack;
+    stack = nullptr;
+  }
+  state.SetItemsProcessed(state.iterations() * kOpsPerIteration);
+}
+
+void ThreadCounts(benchmark::internal::Benchmark *b) {
+  int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  b->ThreadRange(1, std::max(cores, 2))->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StackSharedFreeList, MutexStack)->Apply(ThreadCounts);
+BENCHMARK_TEMPLATE(BM_StackSharedFreeList, s21::LockFreeStack<int>)
+    ->Apply(ThreadCounts);
@@ -0,0 +1,208 @@
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using S21Map = s21::Map<int, int>;
+using StdMap = std::map<int, int>;
+using S21PoolMap =
+    s21::Map<int, int, std::less<int>, s21::PoolAllocator<int>>;
+using S21StringMap = s21::Map<std::string, int>;
+using S21TransparentMap = s21::Map<std::string, int, std::less<>>;
+using StdTransparentMap = std::map<std::string, int, std::less<>>;
+
+namespace {
+
+template <typename Container>
+Container Filled(const std::vector<int> &keys) {
+  Container m;
+  for (int key : keys) {
+    m.insert({key, key});
+  }
+  return m;
+}
+
+bool Contains(const S21Map &m, int key) { return m.contains(key); }
+
+bool Contains(const StdMap &m, int key) { return m.find(key) != m.end(); }
+
+// Dotted names longer than the small-string buffer, so that every
+// temporary std::string built for a lookup allocates.
+std::vector<std::string> ConfigNames(int64_t n) {
+  std::vector<std::string> names;
+  for (int key : s21_bench::ShuffledKeys(n)) {
+    names.push_back("service.config.section." + std::to_string(key));
+  }
+  return names;
+}
+
+template <typename Compare>
+constexpr bool kIsTransparent =
+    !std::is_same_v<Compare, std::less<std::string>>;
+
+template <typename Container>
+void BM_MapInsert(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    Container m;
+    for (int key : keys) {
+      m.insert({key, key});
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename Container>
+void BM_MapErase(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container m = Filled<Container>(keys);
+    state.ResumeTiming();
+    while (m.size() != 0) {
+      m.erase(m.begin());
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MapFind(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  const Container m = Filled<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += Contains(m, key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+// Looks keys up through std::string_view; without a transparent comparator
+// each lookup has to materialize a std::string first.
+template <typename Container>
+void BM_MapFindStringView(benchmark::State &state) {
+  const auto names = ConfigNames(state.range(0));
+  Container m;
+  for (size_t i = 0; i < names.size(); ++i) {
+    m.insert({names[i], static_cast<int>(i)});
+  }
+  const std::vector<std::string_view> views(names.begin(), names.end());
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (std::string_view view : views) {
+      if constexpr (kIsTransparent<typename Container::key_compare>) {
+        found += m.find(view) != m.end();
+      } else {
+        found += m.find(std::string(view)) != m.end();
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MapIterate(benchmark::State &state) {
+  Container m = Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      sum += (*it).second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+// Sums windows of 64 consecutive keys, as in a time-window query.
+template <typename Container>
+void BM_MapRangeScan(benchmark::State &state) {
+  constexpr int kWindow = 64;
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  Container m = Filled<Container>(keys);
+  size_t next = 0;
+  for (auto _ : state) {
+    int lo = keys[next++ % keys.size()];
+    long long sum = 0;
+    if constexpr (std::is_same_v<Container, StdMap>) {
+      auto last = m.lower_bound(lo + kWindow);
+      for (auto it = m.lower_bound(lo); it != last; ++it) {
+        sum += it->second;
+      }
+    } else {
+      for (auto &item : m.range(lo, lo + kWindow)) {
+        sum += item.second;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+template <typename Container>
+void BM_MapCopy(benchmark::State &state) {
+  const Container m =
+      Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    Container copy(m);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MapMove(benchmark::State &state) {
+  Container m = Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    Container moved(std::move(m));
+    benchmark::DoNotOptimize(moved.size());
+    m.swap(moved);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MapInsert, S21Map)
+    ->Apply(s21_bench::AllSizes)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_MapInsert, StdMap)
+    ->Apply(s21_bench::AllSizes)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_MapInsert, S21PoolMap)
+    ->Apply(s21_bench::AllSizes)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_MapErase, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapErase, StdMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapErase, S21PoolMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapFind, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapFind, StdMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapFindStringView, S21StringMap)
+    ->RangeMultiplier(10)
+    ->Range(s21_bench::kMinSize, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MapFindStringView, S21TransparentMap)
+    ->RangeMultiplier(10)
+    ->Range(s21_bench::kMinSize, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MapFindStringView, StdTransparentMap)
+    ->RangeMultiplier(10)
+    ->Range(s21_bench::kMinSize, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MapIterate, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapIterate, StdMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapIterate, S21PoolMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapRangeScan, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapRangeScan, StdMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapCopy, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapCopy, StdMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapCopy, S21PoolMap)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapMove, S21Map)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MapMove, StdMap)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr size_t kCapacity = 1024;
+constexpr int64_t kItems = 1 << 20;
+
+// s21::Queue behind one mutex, bounded like the ring.
+class MutexQueue {
+ public:
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= kCapacity) {
+      return false;
+    }
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<int> queue_;
+};
+
+class MpmcRing {
+ public:
+  bool try_push(int value) { return queue_.try_push(value); }
+  bool try_pop(int &out) { return queue_.try_pop(out); }
+
+ private:
+  s21::MpmcQueue<int> queue_{kCapacity};
+};
+
+// Moves kItems ints through the queue with range(0) producer and range(1)
+// consumer threads.
+template <typename Channel>
+void BM_QueueFanIn(benchmark::State &state) {
+  const int producers = static_cast<int>(state.range(0));
+  const int consumers = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    Channel channel;
+    std::atomic<int64_t> received(0);
+    std::atomic<long long> sum(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&channel, p, producers] {
+        for (int64_t i = p; i < kItems; i += producers) {
+          while (!channel.try_push(static_cast<int>(i))) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&channel, &received, &sum] {
+        long long local = 0;
+        int value;
+        while (received.load(std::memory_order_relaxed) < kItems) {
+          if (channel.try_pop(value)) {
+            local += value;
+            received.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            std::this_thread::yield();
+          }
+        }
+        sum.fetch_add(local);
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    benchmark::DoNotOptimize(sum.load());
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+// producers x consumers in powers of two from 1 to the core count
+void ThreadCounts(benchmark::internal::Benchmark *b) {
+  int64_t cores = std::max(1u, std::thread::hardware_concurrency());
+  for (int64_t p = 1; p <= cores; p *= 2) {
+    for (int64_t c = 1; c <= cores; c *= 2) {
+      b->Args({p, c});
+    }
+  }
+  b->ArgNames({"producers", "consumers"})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_QueueFanIn, MutexQueue)->Apply(ThreadCounts);
+BENCHMARK_TEMPLATE(BM_QueueFanIn, MpmcRing)->Apply(ThreadCounts);
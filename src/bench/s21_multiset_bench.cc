@@ -0,0 +1,167 @@
+#include <iterator>
+#include <set>
+
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using S21Multiset = s21::Multiset<int>;
+using StdMultiset = std::multiset<int>;
+using S21PoolMultiset = s21::Multiset<int, s21::PoolAllocator<int>>;
+
+namespace {
+
+template <typename Container>
+Container Filled(const std::vector<int> &keys) {
+  Container s;
+  for (int key : keys) {
+    s.insert(key);
+  }
+  return s;
+}
+
+// Every key in 1..n/2 appears twice.
+std::vector<int> DuplicatedKeys(int64_t n) {
+  auto keys = s21_bench::ShuffledKeys(n);
+  for (int &key : keys) {
+    key = (key + 1) / 2;
+  }
+  return keys;
+}
+
+bool Contains(const S21Multiset &s, int key) { return s.contains(key); }
+
+bool Contains(const StdMultiset &s, int key) { return s.find(key) != s.end(); }
+
+int Percentile(S21Multiset &s, size_t percent) {
+  return *s.nth(s.size() * percent / 100);
+}
+
+int Percentile(StdMultiset &s, size_t percent) {
+  return *std::next(s.begin(), s.size() * percent / 100);
+}
+
+template <typename Container>
+void BM_MultisetInsert(benchmark::State &state) {
+  const auto keys = DuplicatedKeys(state.range(0));
+  for (auto _ : state) {
+    Container s;
+    for (int key : keys) {
+      s.insert(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MultisetErase(benchmark::State &state) {
+  const auto keys = DuplicatedKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container s = Filled<Container>(keys);
+    state.ResumeTiming();
+    for (int key : keys) {
+      s.erase(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MultisetFind(benchmark::State &state) {
+  const auto keys = DuplicatedKeys(state.range(0));
+  const Container s = Filled<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += Contains(s, key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+// count() of every key: O(log n) each with subtree sizes
+template <typename Container>
+void BM_MultisetCount(benchmark::State &state) {
+  const auto keys = DuplicatedKeys(state.range(0));
+  const Container s = Filled<Container>(keys);
+  for (auto _ : state) {
+    size_t total = 0;
+    for (int key : keys) {
+      total += s.count(key);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  s21_bench::SetItems(state);
+}
+
+// p50, p90 and p99 of the multiset
+template <typename Container>
+void BM_MultisetPercentile(benchmark::State &state) {
+  Container s = Filled<Container>(DuplicatedKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = Percentile(s, 50) + Percentile(s, 90) + Percentile(s, 99);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+template <typename Container>
+void BM_MultisetIterate(benchmark::State &state) {
+  Container s = Filled<Container>(DuplicatedKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MultisetCopy(benchmark::State &state) {
+  const Container s =
+      Filled<Container>(DuplicatedKeys(state.range(0)));
+  for (auto _ : state) {
+    Container copy(s);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_MultisetMove(benchmark::State &state) {
+  Container s = Filled<Container>(DuplicatedKeys(state.range(0)));
+  for (auto _ : state) {
+    Container moved(std::move(s));
+    benchmark::DoNotOptimize(moved.size());
+    s.swap(moved);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MultisetInsert, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetInsert, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetInsert, S21PoolMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetErase, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetErase, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetErase, S21PoolMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetFind, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetFind, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetCount, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetCount, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetPercentile, S21Multiset)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetPercentile, StdMultiset)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetIterate, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetIterate, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetIterate, S21PoolMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetCopy, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetCopy, StdMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetCopy, S21PoolMultiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetMove, S21Multiset)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_MultisetMove, StdMultiset)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,77 @@
+#include <queue>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using S21Queue = s21::Queue<int>;
+using StdQueue = std::queue<int>;
+
+namespace {
+
+template <typename Container>
+Container Filled(int64_t n) {
+  Container q;
+  for (int64_t i = 0; i < n; ++i) {
+    q.push(static_cast<int>(i));
+  }
+  return q;
+}
+
+template <typename Container>
+void BM_QueuePush(benchmark::State &state) {
+  for (auto _ : state) {
+    Container q;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      q.push(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(q.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_QueuePop(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container q = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    long long sum = 0;
+    while (!q.empty()) {
+      sum += q.front();
+      q.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_QueueCopy(benchmark::State &state) {
+  const Container q = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container copy(q);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_QueueMove(benchmark::State &state) {
+  Container q = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container moved(std::move(q));
+    benchmark::DoNotOptimize(moved.size());
+    q.swap(moved);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_QueuePush, S21Queue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueuePush, StdQueue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueuePop, S21Queue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueuePop, StdQueue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueueCopy, S21Queue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueueCopy, StdQueue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueueMove, S21Queue)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_QueueMove, StdQueue)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,156 @@
+#include <set>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using S21Set = s21::Set<int>;
+using StdSet = std::set<int>;
+using S21PoolSet = s21::Set<int, s21::PoolAllocator<int>>;
+
+namespace {
+
+template <typename Container>
+Container Filled(const std::vector<int> &keys) {
+  Container s;
+  for (int key : keys) {
+    s.insert(key);
+  }
+  return s;
+}
+
+bool Contains(const S21Set &s, int key) { return s.contains(key); }
+
+bool Contains(const StdSet &s, int key) { return s.find(key) != s.end(); }
+
+S21Set FromSorted(const std::vector<int> &keys, S21Set *) {
+  return S21Set::from_sorted(keys.begin(), keys.end());
+}
+
+// the range constructor of std::set is linear for sorted input
+StdSet FromSorted(const std::vector<int> &keys, StdSet *) {
+  return StdSet(keys.begin(), keys.end());
+}
+
+template <typename Container>
+void BM_SetInsert(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    Container s;
+    for (int key : keys) {
+      s.insert(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+// one insert() per key of a sorted range, the baseline for BM_SetFromSorted
+template <typename Container>
+void BM_SetInsertSorted(benchmark::State &state) {
+  auto keys = s21_bench::ShuffledKeys(state.range(0));
+  std::sort(keys.begin(), keys.end());
+  for (auto _ : state) {
+    Container s;
+    for (int key : keys) {
+      s.insert(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetFromSorted(benchmark::State &state) {
+  auto keys = s21_bench::ShuffledKeys(state.range(0));
+  std::sort(keys.begin(), keys.end());
+  for (auto _ : state) {
+    Container s = FromSorted(keys, static_cast<Container *>(nullptr));
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetErase(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container s = Filled<Container>(keys);
+    state.ResumeTiming();
+    for (int key : keys) {
+      s.erase(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetFind(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  const Container s = Filled<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += Contains(s, key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetIterate(benchmark::State &state) {
+  Container s = Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetCopy(benchmark::State &state) {
+  const Container s =
+      Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    Container copy(s);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_SetMove(benchmark::State &state) {
+  Container s = Filled<Container>(s21_bench::ShuffledKeys(state.range(0)));
+  for (auto _ : state) {
+    Container moved(std::move(s));
+    benchmark::DoNotOptimize(moved.size());
+    s.swap(moved);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SetInsert, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetInsert, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetInsert, S21PoolSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetInsertSorted, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetFromSorted, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetFromSorted, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetErase, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetErase, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetErase, S21PoolSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetFind, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetFind, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetIterate, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetIterate, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetIterate, S21PoolSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetCopy, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetCopy, StdSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetCopy, S21PoolSet)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetMove, S21Set)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_SetMove, StdSet)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr int kKeys = 1 << 16;
+constexpr int kOpsPerIteration = 1000;
+
+// The baseline: one s21::Map behind one mutex.
+class GlobalLockMap {
+ public:
+  bool find(int key, int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return false;
+    }
+    out = (*it).second;
+    return true;
+  }
+
+  void insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Map<int, int> map_;
+};
+
+using S21ShardedMap = s21::ShardedMap<int, int, 32>;
+
+// range(0) percent of the operations are lookups, the rest overwrite an
+// existing key; all threads share one map filled by thread 0.
+template <typename Container>
+void BM_MapSharedMix(benchmark::State &state) {
+  static Container *map = nullptr;
+  if (state.thread_index() == 0) {
+    map = new Container;
+    for (int key : s21_bench::ShuffledKeys(kKeys)) {
+      map->insert_or_assign(key, key);
+    }
+  }
+  const int read_percent = static_cast<int>(state.range(0));
+  std::mt19937 rng(s21_bench::kSeed + state.thread_index());
+  std::uniform_int_distribution<int> key_dist(1, kKeys);
+  std::uniform_int_distribution<int> op_dist(0, 99);
+  long long sum = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < kOpsPerIteration; ++i) {
+      int key = key_dist(rng);
+      if (op_dist(rng) < read_percent) {
+        int value = 0;
+        map->find(key, value);
+        sum += value;
+      } else {
+        map->insert_or_assign(key, i);
+      }
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  if (state.thread_index() == 0) {
+    delete map;
+    map = nullptr;
+  }
+  state.SetItemsProcessed(state.iterations() * kOpsPerIteration);
+}
+
+// read-heavy (95% lookups) and write-heavy (20% lookups) mixes on 1 to the
+// core count threads
+void Mixes(benchmark::internal::Benchmark *b) {
+  int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  b->ArgName("read_percent")
+      ->Arg(95)
+      ->Arg(20)
+      ->ThreadRange(1, std::max(cores, 2))
+      ->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MapSharedMix, GlobalLockMap)->Apply(Mixes);
+BENCHMARK_TEMPLATE(BM_MapSharedMix, S21ShardedMap)->Apply(Mixes);
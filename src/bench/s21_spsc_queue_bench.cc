@@ -0,0 +1,115 @@
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr size_t kCapacity = 1024;
+constexpr size_t kBatch = 64;
+
+// s21::Queue behind a mutex, bounded like the ring so neither side can run
+// arbitrarily far ahead.
+class MutexQueue {
+ public:
+  size_t PushN(const int *items, size_t n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (; count < n && queue_.size() < kCapacity; ++count) {
+      queue_.push(items[count]);
+    }
+    return count;
+  }
+
+  size_t PopN(int *out, size_t n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (; count < n && !queue_.empty(); ++count) {
+      out[count] = queue_.front();
+      queue_.pop();
+    }
+    return count;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<int> queue_;
+};
+
+class SpscRing {
+ public:
+  size_t PushN(const int *items, size_t n) {
+    if (n == 1) {
+      return queue_.try_push(*items) ? 1 : 0;
+    }
+    return queue_.push_n(items, n);
+  }
+
+  size_t PopN(int *out, size_t n) {
+    if (n == 1) {
+      return queue_.try_pop(*out) ? 1 : 0;
+    }
+    return queue_.pop_n(out, n);
+  }
+
+ private:
+  s21::SpscQueue<int> queue_{kCapacity};
+};
+
+// Moves state.range(0) ints from a producer thread to the benchmark thread,
+// batch elements per call on both sides.
+template <typename Channel, size_t batch>
+void BM_QueueHandoff(benchmark::State &state) {
+  const int64_t n = state.range(0);
+  for (auto _ : state) {
+    Channel channel;
+    std::thread producer([&channel, n] {
+      int items[batch];
+      for (int64_t sent = 0; sent < n;) {
+        size_t want = static_cast<size_t>(n - sent) < batch
+                          ? static_cast<size_t>(n - sent)
+                          : batch;
+        for (size_t i = 0; i < want; ++i) {
+          items[i] = static_cast<int>(sent + i);
+        }
+        size_t done = 0;
+        while (done < want) {
+          size_t pushed = channel.PushN(items + done, want - done);
+          if (pushed == 0) {
+            std::this_thread::yield();
+          }
+          done += pushed;
+        }
+        sent += want;
+      }
+    });
+    int out[batch];
+    long long sum = 0;
+    for (int64_t received = 0; received < n;) {
+      size_t got = channel.PopN(out, batch);
+      if (got == 0) {
+        std::this_thread::yield();
+      }
+      for (size_t i = 0; i < got; ++i) {
+        sum += out[i];
+      }
+      received += got;
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+void HandoffSizes(benchmark::internal::Benchmark *b) {
+  b->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_QueueHandoff, MutexQueue, 1)->Apply(HandoffSizes);
+BENCHMARK_TEMPLATE(BM_QueueHandoff, SpscRing, 1)->Apply(HandoffSizes);
+BENCHMARK_TEMPLATE(BM_QueueHandoff, MutexQueue, kBatch)->Apply(HandoffSizes);
+BENCHMARK_TEMPLATE(BM_QueueHandoff, SpscRing, kBatch)->Apply(HandoffSizes);
@@ -0,0 +1,82 @@
+#include <stack>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using S21Stack = Stack<int>;
+using S21ArrayStack = ArrayStack<int>;
+using StdStack = std::stack<int>;
+
+namespace {
+
+template <typename Container>
+Container Filled(int64_t n) {
+  Container s;
+  for (int64_t i = 0; i < n; ++i) {
+    s.push(static_cast<int>(i));
+  }
+  return s;
+}
+
+template <typename Container>
+void BM_StackPush(benchmark::State &state) {
+  for (auto _ : state) {
+    Container s;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      s.push(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_StackPop(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container s = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    long long sum = 0;
+    while (s.size() != 0) {
+      sum += s.top();
+      s.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_StackCopy(benchmark::State &state) {
+  const Container s = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container copy(s);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_StackMove(benchmark::State &state) {
+  Container s = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container moved(std::move(s));
+    benchmark::DoNotOptimize(moved.size());
+    s.swap(moved);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StackPush, S21Stack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackPush, S21ArrayStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackPush, StdStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackPop, S21Stack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackPop, S21ArrayStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackPop, StdStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackCopy, S21Stack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackCopy, S21ArrayStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackCopy, StdStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackMove, S21Stack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackMove, S21ArrayStack)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_StackMove, StdStack)->Apply(s21_bench::AllSizes);
@@ -0,0 +1,100 @@
+#include <unordered_map>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using S21UnorderedMap = s21::UnorderedMap<int, int>;
+using S21OrderedMap = s21::Map<int, int>;
+using StdUnorderedMap = std::unordered_map<int, int>;
+
+namespace {
+
+template <typename Container>
+Container FilledHash(const std::vector<int> &keys) {
+  Container m;
+  for (int key : keys) {
+    m.insert({key, key});
+  }
+  return m;
+}
+
+template <typename Container>
+void BM_HashInsert(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    Container m;
+    for (int key : keys) {
+      m.insert({key, key});
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_HashFindHit(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  Container m = FilledHash<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += m.find(key) != m.end();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+// keys n+1..2n, none of them present
+template <typename Container>
+void BM_HashFindMiss(benchmark::State &state) {
+  const int64_t n = state.range(0);
+  const auto keys = s21_bench::ShuffledKeys(n);
+  Container m = FilledHash<Container>(keys);
+  for (auto _ : state) {
+    int64_t found = 0;
+    for (int key : keys) {
+      found += m.find(key + static_cast<int>(n)) != m.end();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_HashEraseByKey(benchmark::State &state) {
+  const auto keys = s21_bench::ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container m = FilledHash<Container>(keys);
+    state.ResumeTiming();
+    for (int key : keys) {
+      m.erase(m.find(key));
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  s21_bench::SetItems(state);
+}
+
+// 1e2 .. 1e6 elements
+void HashSizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)
+      ->Range(s21_bench::kMinSize, 1'000'000)
+      ->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_HashInsert, S21UnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashInsert, S21OrderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashInsert, StdUnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindHit, S21UnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindHit, S21OrderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindHit, StdUnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindMiss, S21UnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindMiss, S21OrderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashFindMiss, StdUnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashEraseByKey, S21UnorderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashEraseByKey, S21OrderedMap)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashEraseByKey, StdUnorderedMap)->Apply(HashSizes);
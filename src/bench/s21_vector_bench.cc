@@ -0,0 +1,177 @@
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../vector/s21_small_vector.h"
+#include "s21_bench.h"
+
+using S21Vector = s21::Vector<int>;
+using StdVector = std::vector<int>;
+using S21SmallVector = s21::SmallVector<int, 8>;
+
+namespace {
+
+template <typename Container>
+Container Filled(int64_t n) {
+  Container v;
+  for (int64_t i = 0; i < n; ++i) {
+    v.push_back(static_cast<int>(i));
+  }
+  return v;
+}
+
+S21Vector::iterator Middle(S21Vector &v) {
+  return S21Vector::iterator(v.data() + v.size() / 2);
+}
+
+StdVector::iterator Middle(StdVector &v) { return v.begin() + v.size() / 2; }
+
+template <typename Container>
+void BM_VectorPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    Container v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+// Erases from the back, the only position where both vectors are O(1).
+template <typename Container>
+void BM_VectorErase(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container v = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto last = v.end();
+      --last;
+      v.erase(last);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_VectorIterate(benchmark::State &state) {
+  Container v = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = v.begin(); it != v.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_VectorCopy(benchmark::State &state) {
+  const Container v = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container copy(v);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_VectorMove(benchmark::State &state) {
+  Container v = Filled<Container>(state.range(0));
+  for (auto _ : state) {
+    Container moved(std::move(v));
+    benchmark::DoNotOptimize(moved.data());
+    v.swap(moved);
+  }
+}
+
+// One element at a time into the middle: quadratic, so sizes stop at 1e5.
+template <typename Container>
+void BM_VectorInsertMiddle(benchmark::State &state) {
+  for (auto _ : state) {
+    Container v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.insert(Middle(v), static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_VectorInsertRange(benchmark::State &state) {
+  const std::vector<int> items(static_cast<size_t>(state.range(0)), 21);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container v = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    v.insert(Middle(v), items.begin(), items.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+template <typename Container>
+void BM_VectorEraseRange(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container v = Filled<Container>(state.range(0));
+    state.ResumeTiming();
+    v.erase(v.begin(), Middle(v));
+    benchmark::DoNotOptimize(v.data());
+  }
+  s21_bench::SetItems(state);
+}
+
+// Builds and drops many short vectors: the case the inline buffer is for.
+template <typename Container>
+void BM_VectorShortLived(benchmark::State &state) {
+  for (auto _ : state) {
+    for (int n = 0; n < 1000; ++n) {
+      Container v;
+      for (int64_t i = 0; i < state.range(0); ++i) {
+        v.push_back(static_cast<int>(i));
+      }
+      benchmark::DoNotOptimize(v.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+
+void ShortSizes(benchmark::internal::Benchmark *b) {
+  b->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_VectorPushBack, S21Vector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorPushBack, StdVector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorErase, S21Vector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorErase, StdVector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorIterate, S21Vector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorIterate, StdVector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorCopy, S21Vector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorCopy, StdVector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorMove, S21Vector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorMove, StdVector)->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, S21Vector)
+    ->RangeMultiplier(10)
+    ->Range(s21_bench::kMinSize, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, StdVector)
+    ->RangeMultiplier(10)
+    ->Range(s21_bench::kMinSize, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_VectorInsertRange, S21Vector)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorInsertRange, StdVector)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorEraseRange, S21Vector)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorEraseRange, StdVector)
+    ->Apply(s21_bench::AllSizes);
+BENCHMARK_TEMPLATE(BM_VectorShortLived, S21Vector)->Apply(ShortSizes);
+BENCHMARK_TEMPLATE(BM_VectorShortLived, S21SmallVector)->Apply(ShortSizes);
+BENCHMARK_TEMPLATE(BM_VectorShortLived, StdVector)->Apply(ShortSizes);
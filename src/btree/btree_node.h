@@ -0,0 +1,121 @@
+#ifndef _BTREE_NODE_H_
+#define _BTREE_NODE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Nodes of BTreeMap, a B+ tree: every element lives in a leaf, inner nodes
+// hold separator keys only, and the leaves are chained in key order. A node
+// keeps its keys in one array, so the search inside a node reads a few
+// adjacent cache lines; values sit in a parallel array of the leaf and are
+// only touched once the key is found. Arrays are raw storage: slots
+// [0, count) hold live objects, the rest are unconstructed.
+
+// Bytes of keys per node; 256 is four cache lines, and for int keys gives
+// a fan-out of 64, so a tree of 1e7 keys is four levels deep.
+constexpr size_t kBTreeKeyBytes = 256;
+
+template <typename Key>
+constexpr size_t BTreeSlots() {
+  return std::max<size_t>(8, kBTreeKeyBytes / sizeof(Key));
+}
+
+struct BTreeNode {
+  size_t count;
+  bool leaf;
+};
+
+template <typename V, size_t N>
+class BTreeSlotArray {
+  // OpenGap, CloseGap and MoveFrom cannot undo a half-done shift
+  static_assert(std::is_nothrow_move_constructible_v<V>,
+                "BTreeMap needs noexcept move constructors of Key and T");
+
+ public:
+  V *data() noexcept { return std::launder(reinterpret_cast<V *>(storage_)); }
+
+  const V *data() const noexcept {
+    return std::launder(reinterpret_cast<const V *>(storage_));
+  }
+
+  V &operator[](size_t i) noexcept { return data()[i]; }
+  const V &operator[](size_t i) const noexcept { return data()[i]; }
+
+  template <typename... Args>
+  void Construct(size_t i, Args &&...args) {
+    ::new (static_cast<void *>(data() + i)) V(std::forward<Args>(args)...);
+  }
+
+  void Destroy(size_t i) noexcept { data()[i].~V(); }
+
+  void Destroy(size_t first, size_t last) noexcept {
+    for (; first != last; ++first) {
+      Destroy(first);
+    }
+  }
+
+  // moves [from, count) one slot right, leaving slot from unconstructed
+  void OpenGap(size_t from, size_t count) noexcept {
+    for (size_t i = count; i > from; --i) {
+      Construct(i, std::move(data()[i - 1]));
+      Destroy(i - 1);
+    }
+  }
+
+  // the reverse of OpenGap: slot from is unconstructed on entry
+  void CloseGap(size_t from, size_t count) noexcept {
+    for (size_t i = from; i + 1 < count; ++i) {
+      Construct(i, std::move(data()[i + 1]));
+      Destroy(i + 1);
+    }
+  }
+
+  // moves n objects from other[src] into unconstructed slots at dst
+  void MoveFrom(BTreeSlotArray &other, size_t src, size_t dst,
+                size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+      Construct(dst + i, std::move(other[src + i]));
+      other.Destroy(src + i);
+    }
+  }
+
+ private:
+  alignas(V) unsigned char storage_[sizeof(V) * N];
+};
+
+template <typename Key, typename T>
+struct BTreeLeaf : BTreeNode {
+  static constexpr size_t kSlots = BTreeSlots<Key>();
+  // a leaf other than the root never drops below kMin elements
+  static constexpr size_t kMin = kSlots / 2;
+
+  BTreeLeaf() noexcept : BTreeNode{0, true}, prev(nullptr), next(nullptr) {}
+
+  BTreeLeaf *prev;
+  BTreeLeaf *next;
+  BTreeSlotArray<Key, kSlots> keys;
+  BTreeSlotArray<T, kSlots> values;
+};
+
+template <typename Key>
+struct BTreeInner : BTreeNode {
+  static constexpr size_t kSlots = BTreeSlots<Key>();
+  // an inner node with kMin keys, a separator and another kMin keys still
+  // fits one node, which is what a merge produces
+  static constexpr size_t kMin = (kSlots - 1) / 2;
+
+  BTreeInner() noexcept : BTreeNode{0, false} {}
+
+  // children[i] holds the keys in [keys[i - 1], keys[i])
+  BTreeSlotArray<Key, kSlots> keys;
+  BTreeNode *children[kSlots + 1];
+};
+
+}  // namespace s21
+
+#endif  // _BTREE_NODE_H_
@@ -0,0 +1,839 @@
+#ifndef _BTREE_MAP_H_
+#define _BTREE_MAP_H_
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../flat/flat_search.h"
+#include "btree_node.h"
+
+namespace s21 {
+
+template <typename Key, typename T, bool IsConst>
+class BTreeMapIterator;
+
+// Ordered map on a B+ tree (btree_node.h), with the interface of s21::Map.
+// A red-black tree spends a node, three pointers and a cache miss on every
+// key it passes; here one node holds up to BTreeSlots<Key>() keys side by
+// side, searched branch-free (flat_search.h), so a lookup in 1e7 int keys
+// reads four nodes instead of some 24, and a scan walks the leaf chain
+// reading keys and values sequentially.
+//
+// Insert and erase descend once from the root, noting the deepest node on
+// the path that can take the change; a hit, a miss, or a change that fits
+// the leaf ends there. Otherwise only the full (insert) or minimal (erase)
+// nodes below that node are split or topped up, top-down. Insertion and
+// erasure move elements between slots and nodes: they invalidate all
+// iterators and references, and element types must have non-throwing move
+// constructors. As in FlatMap, keys and values are
+// stored apart, so *it is a pair of references.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<T>>
+class BTreeMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using key_compare = Compare;
+  using value_type = std::pair<const Key, T>;
+  using reference = std::pair<const Key &, T &>;
+  using const_reference = std::pair<const Key &, const T &>;
+  using allocator_type = Alloc;
+  using iterator = BTreeMapIterator<Key, T, false>;
+  using const_iterator = BTreeMapIterator<Key, T, true>;
+  using size_type = size_t;
+
+  BTreeMap() noexcept
+      : leaf_alloc_(),
+        inner_alloc_(),
+        compare_(),
+        root_(nullptr),
+        first_(nullptr),
+        last_(nullptr),
+        size_(0) {}
+
+  BTreeMap(std::initializer_list<value_type> const &items) : BTreeMap() {
+    for (auto i = items.begin(); i != items.end(); ++i) {
+      insert(*i);
+    }
+  }
+
+  template <typename InputIt>
+  BTreeMap(InputIt first, InputIt last) : BTreeMap() {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  BTreeMap(const BTreeMap &other) : BTreeMap() {
+    compare_ = other.compare_;
+    if (other.root_ != nullptr) {
+      Leaf *prev = nullptr;
+      root_ = Clone(other.root_, prev);
+      last_ = prev;
+      size_ = other.size_;
+    }
+  }
+
+  BTreeMap(BTreeMap &&other) noexcept : BTreeMap() { swap(other); }
+
+  BTreeMap &operator=(const BTreeMap &other) {
+    if (this != &other) {
+      BTreeMap copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  BTreeMap &operator=(BTreeMap &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~BTreeMap() { clear(); }
+
+  T &at(const Key &key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("error");
+    }
+    return it.leaf_->values[it.index_];
+  }
+
+  const T &at(const Key &key) const {
+    const_iterator it = find(key);
+    if (it == cend()) {
+      throw std::out_of_range("error");
+    }
+    return it.leaf_->values[it.index_];
+  }
+
+  T &operator[](const key_type &key) {
+    iterator it = TryEmplace(key).first;
+    return it.leaf_->values[it.index_];
+  }
+
+  iterator begin() noexcept { return iterator(first_, 0); }
+
+  iterator end() noexcept { return iterator(last_, EndIndex()); }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept { return const_iterator(first_, 0); }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(last_, EndIndex());
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::allocator_traits<LeafAlloc>::max_size(leaf_alloc_);
+  }
+
+  void clear() noexcept {
+    if (root_ != nullptr) {
+      DestroySubtree(root_);
+    }
+    root_ = nullptr;
+    first_ = nullptr;
+    last_ = nullptr;
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return TryEmplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return TryEmplace(value.first, std::move(value.second));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return TryEmplace(key, obj);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto result = TryEmplace(key, obj);
+    if (!result.second) {
+      result.first.leaf_->values[result.first.index_] = obj;
+    }
+    return result;
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             mapped_type &&obj) {
+    auto result = TryEmplace(key, std::move(obj));
+    if (!result.second) {
+      result.first.leaf_->values[result.first.index_] = std::move(obj);
+    }
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  void erase(const_iterator pos) {
+    if (pos != cend()) {
+      erase(pos.leaf_->keys[pos.index_]);
+    }
+  }
+
+  // number of elements removed (0 or 1)
+  size_type erase(const key_type &target) {
+    if (root_ == nullptr) {
+      return 0;
+    }
+    // one descent finds the leaf of target and the deepest node on the way
+    // that can lose an element; only the minimal nodes below it are topped up
+    BTreeNode *top = root_;
+    BTreeNode *node = root_;
+    while (!node->leaf) {
+      Inner *inner = static_cast<Inner *>(node);
+      node = inner->children[ChildIndex(inner, target)];
+      if (node->count > MinCount(node)) {
+        top = node;
+      }
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    size_type pos = LeafLowerBound(leaf, target);
+    if (pos == leaf->count || compare_(target, leaf->keys[pos])) {
+      return 0;
+    }
+    if (top != leaf) {
+      // target may be a key in the tree, which the rebalancing below moves
+      key_type key(target);
+      leaf = ReinforcePath(static_cast<Inner *>(top), key);
+      pos = LeafLowerBound(leaf, key);
+    }
+    leaf->keys.Destroy(pos);
+    leaf->keys.CloseGap(pos, leaf->count);
+    leaf->values.Destroy(pos);
+    leaf->values.CloseGap(pos, leaf->count);
+    --leaf->count;
+    --size_;
+    return 1;
+  }
+
+  void swap(BTreeMap &other) noexcept {
+    std::swap(leaf_alloc_, other.leaf_alloc_);
+    std::swap(inner_alloc_, other.inner_alloc_);
+    std::swap(compare_, other.compare_);
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(size_, other.size_);
+  }
+
+  // Moves in the elements of other whose keys are not here yet; the rest
+  // stay in other, as with std::map::merge.
+  void merge(BTreeMap &other) {
+    if (this == &other) {
+      return;
+    }
+    BTreeMap rest;
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      T &value = it.leaf_->values[it.index_];
+      if (!TryEmplace((*it).first, std::move(value)).second) {
+        rest.TryEmplace((*it).first, std::move(value));
+      }
+    }
+    other.swap(rest);
+  }
+
+  bool contains(const Key &key) const { return find(key) != cend(); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return find(key) != cend();
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  iterator find(const key_type &key) {
+    const_iterator it = FindIterator(key);
+    return iterator(it.leaf_, it.index_);
+  }
+
+  const_iterator find(const key_type &key) const { return FindIterator(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    const_iterator it = FindIterator(key);
+    return iterator(it.leaf_, it.index_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return FindIterator(key);
+  }
+
+  // first element whose key is not less than key
+  iterator lower_bound(const key_type &key) {
+    const_iterator it = Bound<false>(key);
+    return iterator(it.leaf_, it.index_);
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return Bound<false>(key);
+  }
+
+  // first element whose key is greater than key
+  iterator upper_bound(const key_type &key) {
+    const_iterator it = Bound<true>(key);
+    return iterator(it.leaf_, it.index_);
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return Bound<true>(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ private:
+  using Leaf = BTreeLeaf<Key, T>;
+  using Inner = BTreeInner<Key>;
+  using LeafAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Leaf>;
+  using InnerAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Inner>;
+
+  size_type EndIndex() const noexcept {
+    return last_ == nullptr ? 0 : last_->count;
+  }
+
+  static bool IsFull(const BTreeNode *node) noexcept {
+    return node->count == (node->leaf ? Leaf::kSlots : Inner::kSlots);
+  }
+
+  static size_type MinCount(const BTreeNode *node) noexcept {
+    return node->leaf ? Leaf::kMin : Inner::kMin;
+  }
+
+  // the child of inner whose key range holds key
+  template <typename K>
+  size_type ChildIndex(const Inner *inner, const K &key) const {
+    return FlatUpperBound(inner->keys.data(), inner->count, key, compare_);
+  }
+
+  template <typename K>
+  size_type LeafLowerBound(const Leaf *leaf, const K &key) const {
+    return FlatLowerBound(leaf->keys.data(), leaf->count, key, compare_);
+  }
+
+  // the leaf whose key range holds key; the tree must not be empty
+  template <typename K>
+  Leaf *LeafFor(const K &key) const {
+    BTreeNode *node = root_;
+    while (!node->leaf) {
+      Inner *inner = static_cast<Inner *>(node);
+      node = inner->children[ChildIndex(inner, key)];
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  // past the last slot of a leaf is the first slot of the next one
+  const_iterator Normalize(Leaf *leaf, size_type index) const noexcept {
+    if (index == leaf->count && leaf->next != nullptr) {
+      return const_iterator(leaf->next, 0);
+    }
+    return const_iterator(leaf, index);
+  }
+
+  template <typename K>
+  const_iterator FindIterator(const K &key) const {
+    if (root_ == nullptr) {
+      return cend();
+    }
+    Leaf *leaf = LeafFor(key);
+    size_type index = LeafLowerBound(leaf, key);
+    if (index == leaf->count || compare_(key, leaf->keys[index])) {
+      return cend();
+    }
+    return const_iterator(leaf, index);
+  }
+
+  template <bool Upper>
+  const_iterator Bound(const key_type &key) const {
+    if (root_ == nullptr) {
+      return cend();
+    }
+    Leaf *leaf = LeafFor(key);
+    size_type index =
+        Upper ? FlatUpperBound(leaf->keys.data(), leaf->count, key, compare_)
+              : LeafLowerBound(leaf, key);
+    return Normalize(leaf, index);
+  }
+
+  // (position of key, true if it was inserted with a value built from args)
+  template <typename... Args>
+  std::pair<iterator, bool> TryEmplace(const key_type &key, Args &&...args) {
+    if (root_ == nullptr) {
+      root_ = first_ = last_ = NewLeaf();
+    }
+    // one descent finds the leaf of key and the deepest inner node on the way
+    // with room for another key; only the full nodes below it are split
+    Inner *top = nullptr;
+    BTreeNode *node = root_;
+    while (!node->leaf) {
+      Inner *inner = static_cast<Inner *>(node);
+      if (!IsFull(inner)) {
+        top = inner;
+      }
+      node = inner->children[ChildIndex(inner, key)];
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    size_type pos = LeafLowerBound(leaf, key);
+    if (pos < leaf->count && !compare_(key, leaf->keys[pos])) {
+      return {iterator(leaf, pos), false};
+    }
+    // key may refer into a node that the splits below move
+    key_type copy(key);
+    if (IsFull(leaf)) {
+      leaf = SplitPath(top, copy);
+      pos = LeafLowerBound(leaf, copy);
+    }
+    leaf->keys.OpenGap(pos, leaf->count);
+    leaf->keys.Construct(pos, std::move(copy));
+    leaf->values.OpenGap(pos, leaf->count);
+    try {
+      leaf->values.Construct(pos, std::forward<Args>(args)...);
+    } catch (...) {
+      leaf->values.CloseGap(pos, leaf->count + 1);
+      leaf->keys.Destroy(pos);
+      leaf->keys.CloseGap(pos, leaf->count + 1);
+      throw;
+    }
+    ++leaf->count;
+    ++size_;
+    return {iterator(leaf, pos), true};
+  }
+
+  // Splits the full nodes on the path of key below top, which has room for
+  // another key; with no such node the root is split and the tree grows a
+  // level. Returns the leaf that now takes key, with room for it.
+  Leaf *SplitPath(Inner *top, const key_type &key) {
+    if (top == nullptr) {
+      Inner *root = NewInner();
+      root->children[0] = root_;
+      root_ = root;
+      try {
+        SplitChild(root, 0);
+      } catch (...) {
+        root_ = root->children[0];
+        FreeInner(root);
+        throw;
+      }
+      top = root;
+    }
+    BTreeNode *node = top;
+    while (!node->leaf) {
+      Inner *inner = static_cast<Inner *>(node);
+      size_type i = ChildIndex(inner, key);
+      if (IsFull(inner->children[i])) {
+        SplitChild(inner, i);
+        if (!compare_(key, inner->keys[i])) {
+          ++i;
+        }
+      }
+      node = inner->children[i];
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  // Tops up the minimal nodes on the path of key below top, which is the
+  // root or can lose an element. Returns the leaf that now holds key.
+  Leaf *ReinforcePath(Inner *top, const key_type &key) {
+    BTreeNode *node = top;
+    while (!node->leaf) {
+      Inner *inner = static_cast<Inner *>(node);
+      size_type i = Reinforce(inner, ChildIndex(inner, key));
+      node = inner->children[i];
+      if (inner->count == 0) {
+        // the root's last two children were merged
+        root_ = node;
+        FreeInner(inner);
+      }
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  // Splits the full child i of parent, which has room for one more key, in
+  // two halves. A leaf's separator is a copy of the first key of the right
+  // half; an inner node's middle key moves up.
+  void SplitChild(Inner *parent, size_type i) {
+    BTreeNode *child = parent->children[i];
+    BTreeNode *right_node;
+    if (child->leaf) {
+      Leaf *left = static_cast<Leaf *>(child);
+      Leaf *right = NewLeaf();
+      size_type mid = left->count / 2;
+      parent->keys.OpenGap(i, parent->count);
+      try {
+        parent->keys.Construct(i, left->keys[mid]);
+      } catch (...) {
+        parent->keys.CloseGap(i, parent->count + 1);
+        FreeLeaf(right);
+        throw;
+      }
+      right->count = left->count - mid;
+      right->keys.MoveFrom(left->keys, mid, 0, right->count);
+      right->values.MoveFrom(left->values, mid, 0, right->count);
+      left->count = mid;
+      right->prev = left;
+      right->next = left->next;
+      if (left->next != nullptr) {
+        left->next->prev = right;
+      } else {
+        last_ = right;
+      }
+      left->next = right;
+      right_node = right;
+    } else {
+      Inner *left = static_cast<Inner *>(child);
+      Inner *right = NewInner();
+      size_type mid = left->count / 2;
+      parent->keys.OpenGap(i, parent->count);
+      parent->keys.Construct(i, std::move(left->keys[mid]));
+      left->keys.Destroy(mid);
+      right->count = left->count - mid - 1;
+      right->keys.MoveFrom(left->keys, mid + 1, 0, right->count);
+      std::copy(left->children + mid + 1, left->children + left->count + 1,
+                right->children);
+      left->count = mid;
+      right_node = right;
+    }
+    std::copy_backward(parent->children + i + 1,
+                       parent->children + parent->count + 1,
+                       parent->children + parent->count + 2);
+    parent->children[i + 1] = right_node;
+    ++parent->count;
+  }
+
+  // Makes sure child i of parent can lose an element: a child at its
+  // minimum takes one from a sibling or is merged with it. Returns the
+  // index of the child that now covers the old child's key range.
+  size_type Reinforce(Inner *parent, size_type i) {
+    BTreeNode *child = parent->children[i];
+    size_type min = MinCount(child);
+    if (child->count > min) {
+      return i;
+    }
+    if (i > 0 && parent->children[i - 1]->count > min) {
+      BorrowFromLeft(parent, i);
+      return i;
+    }
+    if (i < parent->count && parent->children[i + 1]->count > min) {
+      BorrowFromRight(parent, i);
+      return i;
+    }
+    if (i > 0) {
+      Merge(parent, i - 1);
+      return i - 1;
+    }
+    Merge(parent, i);
+    return i;
+  }
+
+  void BorrowFromLeft(Inner *parent, size_type i) {
+    if (parent->children[i]->leaf) {
+      Leaf *child = static_cast<Leaf *>(parent->children[i]);
+      Leaf *left = static_cast<Leaf *>(parent->children[i - 1]);
+      size_type last = left->count - 1;
+      key_type separator(left->keys[last]);
+      child->keys.OpenGap(0, child->count);
+      child->keys.MoveFrom(left->keys, last, 0, 1);
+      child->values.OpenGap(0, child->count);
+      child->values.MoveFrom(left->values, last, 0, 1);
+      --left->count;
+      ++child->count;
+      parent->keys[i - 1] = std::move(separator);
+    } else {
+      Inner *child = static_cast<Inner *>(parent->children[i]);
+      Inner *left = static_cast<Inner *>(parent->children[i - 1]);
+      child->keys.OpenGap(0, child->count);
+      child->keys.MoveFrom(parent->keys, i - 1, 0, 1);
+      parent->keys.Construct(i - 1, std::move(left->keys[left->count - 1]));
+      left->keys.Destroy(left->count - 1);
+      std::copy_backward(child->children, child->children + child->count + 1,
+                         child->children + child->count + 2);
+      child->children[0] = left->children[left->count];
+      --left->count;
+      ++child->count;
+    }
+  }
+
+  void BorrowFromRight(Inner *parent, size_type i) {
+    if (parent->children[i]->leaf) {
+      Leaf *child = static_cast<Leaf *>(parent->children[i]);
+      Leaf *right = static_cast<Leaf *>(parent->children[i + 1]);
+      key_type separator(right->keys[1]);
+      child->keys.MoveFrom(right->keys, 0, child->count, 1);
+      right->keys.CloseGap(0, right->count);
+      child->values.MoveFrom(right->values, 0, child->count, 1);
+      right->values.CloseGap(0, right->count);
+      --right->count;
+      ++child->count;
+      parent->keys[i] = std::move(separator);
+    } else {
+      Inner *child = static_cast<Inner *>(parent->children[i]);
+      Inner *right = static_cast<Inner *>(parent->children[i + 1]);
+      child->keys.MoveFrom(parent->keys, i, child->count, 1);
+      parent->keys.MoveFrom(right->keys, 0, i, 1);
+      right->keys.CloseGap(0, right->count);
+      child->children[child->count + 1] = right->children[0];
+      std::copy(right->children + 1, right->children + right->count + 1,
+                right->children);
+      --right->count;
+      ++child->count;
+    }
+  }
+
+  // Merges child j + 1 of parent into child j, together with separator j.
+  void Merge(Inner *parent, size_type j) {
+    BTreeNode *right_node = parent->children[j + 1];
+    if (right_node->leaf) {
+      Leaf *left = static_cast<Leaf *>(parent->children[j]);
+      Leaf *right = static_cast<Leaf *>(right_node);
+      left->keys.MoveFrom(right->keys, 0, left->count, right->count);
+      left->values.MoveFrom(right->values, 0, left->count, right->count);
+      left->count += right->count;
+      left->next = right->next;
+      if (right->next != nullptr) {
+        right->next->prev = left;
+      } else {
+        last_ = left;
+      }
+      parent->keys.Destroy(j);
+      FreeLeaf(right);
+    } else {
+      Inner *left = static_cast<Inner *>(parent->children[j]);
+      Inner *right = static_cast<Inner *>(right_node);
+      left->keys.MoveFrom(parent->keys, j, left->count, 1);
+      left->keys.MoveFrom(right->keys, 0, left->count + 1, right->count);
+      std::copy(right->children, right->children + right->count + 1,
+                left->children + left->count + 1);
+      left->count += right->count + 1;
+      FreeInner(right);
+    }
+    parent->keys.CloseGap(j, parent->count);
+    std::copy(parent->children + j + 2, parent->children + parent->count + 1,
+              parent->children + j + 1);
+    --parent->count;
+  }
+
+  // Copies the subtree of node, appending its leaves to the chain after
+  // prev. A partial copy is freed before the exception leaves.
+  BTreeNode *Clone(const BTreeNode *node, Leaf *&prev) {
+    if (node->leaf) {
+      const Leaf *source = static_cast<const Leaf *>(node);
+      Leaf *copy = NewLeaf();
+      try {
+        for (; copy->count < source->count; ++copy->count) {
+          copy->keys.Construct(copy->count, source->keys[copy->count]);
+          try {
+            copy->values.Construct(copy->count, source->values[copy->count]);
+          } catch (...) {
+            copy->keys.Destroy(copy->count);
+            throw;
+          }
+        }
+      } catch (...) {
+        DestroySubtree(copy);
+        throw;
+      }
+      copy->prev = prev;
+      if (prev != nullptr) {
+        prev->next = copy;
+      } else {
+        first_ = copy;
+      }
+      prev = copy;
+      return copy;
+    }
+    const Inner *source = static_cast<const Inner *>(node);
+    Inner *copy = NewInner();
+    try {
+      copy->children[0] = Clone(source->children[0], prev);
+    } catch (...) {
+      FreeInner(copy);
+      throw;
+    }
+    try {
+      for (; copy->count < source->count; ++copy->count) {
+        copy->keys.Construct(copy->count, source->keys[copy->count]);
+        try {
+          copy->children[copy->count + 1] =
+              Clone(source->children[copy->count + 1], prev);
+        } catch (...) {
+          copy->keys.Destroy(copy->count);
+          throw;
+        }
+      }
+    } catch (...) {
+      DestroySubtree(copy);
+      throw;
+    }
+    return copy;
+  }
+
+  void DestroySubtree(BTreeNode *node) noexcept {
+    if (node->leaf) {
+      Leaf *leaf = static_cast<Leaf *>(node);
+      leaf->keys.Destroy(0, leaf->count);
+      leaf->values.Destroy(0, leaf->count);
+      FreeLeaf(leaf);
+      return;
+    }
+    Inner *inner = static_cast<Inner *>(node);
+    for (size_type i = 0; i <= inner->count; ++i) {
+      DestroySubtree(inner->children[i]);
+    }
+    inner->keys.Destroy(0, inner->count);
+    FreeInner(inner);
+  }
+
+  Leaf *NewLeaf() {
+    Leaf *leaf = std::allocator_traits<LeafAlloc>::allocate(leaf_alloc_, 1);
+    std::allocator_traits<LeafAlloc>::construct(leaf_alloc_, leaf);
+    return leaf;
+  }
+
+  Inner *NewInner() {
+    Inner *inner = std::allocator_traits<InnerAlloc>::allocate(inner_alloc_, 1);
+    std::allocator_traits<InnerAlloc>::construct(inner_alloc_, inner);
+    return inner;
+  }
+
+  // frees the node itself; its elements must already be destroyed
+  void FreeLeaf(Leaf *leaf) noexcept {
+    std::allocator_traits<LeafAlloc>::destroy(leaf_alloc_, leaf);
+    std::allocator_traits<LeafAlloc>::deallocate(leaf_alloc_, leaf, 1);
+  }
+
+  void FreeInner(Inner *inner) noexcept {
+    std::allocator_traits<InnerAlloc>::destroy(inner_alloc_, inner);
+    std::allocator_traits<InnerAlloc>::deallocate(inner_alloc_, inner, 1);
+  }
+
+  LeafAlloc leaf_alloc_;
+  InnerAlloc inner_alloc_;
+  Compare compare_;
+  BTreeNode *root_;
+  Leaf *first_;
+  Leaf *last_;
+  size_type size_;
+};
+
+// Bidirectional iterator over BTreeMap: a leaf and a slot in it. The end
+// position is one past the last slot of the last leaf; every other position
+// past a leaf's last slot is written as the next leaf's first slot.
+template <typename Key, typename T, bool IsConst>
+class BTreeMapIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::pair<const Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using reference =
+      std::pair<const Key &, std::conditional_t<IsConst, const T &, T &>>;
+
+  // what operator-> returns: holds the pair of references
+  class pointer {
+   public:
+    explicit pointer(reference ref) : ref_(ref) {}
+    const reference *operator->() const noexcept { return &ref_; }
+
+   private:
+    reference ref_;
+  };
+
+  template <typename K, typename V, typename C, typename A>
+  friend class BTreeMap;
+  friend class BTreeMapIterator<Key, T, !IsConst>;
+
+  BTreeMapIterator() noexcept : leaf_(nullptr), index_(0) {}
+
+  // iterator converts to const_iterator
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  BTreeMapIterator(const BTreeMapIterator<Key, T, false> &other) noexcept
+      : leaf_(other.leaf_), index_(other.index_) {}
+
+  reference operator*() const {
+    return reference(leaf_->keys[index_], leaf_->values[index_]);
+  }
+
+  pointer operator->() const { return pointer(**this); }
+
+  BTreeMapIterator &operator++() noexcept {
+    ++index_;
+    if (index_ == leaf_->count && leaf_->next != nullptr) {
+      leaf_ = leaf_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  BTreeMapIterator operator++(int) noexcept {
+    BTreeMapIterator copy(*this);
+    ++*this;
+    return copy;
+  }
+
+  BTreeMapIterator &operator--() noexcept {
+    if (index_ == 0) {
+      leaf_ = leaf_->prev;
+      index_ = leaf_->count;
+    }
+    --index_;
+    return *this;
+  }
+
+  BTreeMapIterator operator--(int) noexcept {
+    BTreeMapIterator copy(*this);
+    --*this;
+    return copy;
+  }
+
+  bool operator==(const BTreeMapIterator &other) const noexcept {
+    return leaf_ == other.leaf_ && index_ == other.index_;
+  }
+
+  bool operator!=(const BTreeMapIterator &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  BTreeMapIterator(BTreeLeaf<Key, T> *leaf, size_t index) noexcept
+      : leaf_(leaf), index_(index) {}
+
+  BTreeLeaf<Key, T> *leaf_;
+  size_t index_;
+};
+
+}  // namespace s21
+
+#endif  // _BTREE_MAP_H_
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+template <typename Map, typename StdMap>
+void ExpectSameElements(Map &m, const StdMap &expected) {
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &item : expected) {
+    ASSERT_TRUE(it != m.end());
+    ASSERT_EQ((*it).first, item.first);
+    ASSERT_EQ((*it).second, item.second);
+    ++it;
+  }
+  ASSERT_TRUE(it == m.end());
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(it->first, rit->first);
+  }
+  ASSERT_TRUE(it == m.begin());
+}
+
+// copying throws once the shared countdown reaches zero
+struct Fragile {
+  static int copies_left;
+
+  explicit Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) {
+    if (--copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+  Fragile(Fragile &&other) noexcept : value(other.value) {}
+  Fragile &operator=(const Fragile &) = default;
+
+  int value;
+};
+
+int Fragile::copies_left = -1;
+
+// counts the comparisons made through it
+struct CountingLess {
+  static inline long calls = 0;
+  bool operator()(int lhs, int rhs) const {
+    ++calls;
+    return lhs < rhs;
+  }
+};
+
+template <typename F>
+long ComparisonsIn(F f) {
+  long before = CountingLess::calls;
+  f();
+  return CountingLess::calls - before;
+}
+
+}  // namespace
+
+TEST(TestBTreeMap, BasicOperations) {
+  s21::BTreeMap<int, std::string> m{{2, "two"}, {1, "one"}, {3, "three"}};
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.at(1), "one");
+  ASSERT_TRUE(m.contains(3));
+  ASSERT_FALSE(m.contains(4));
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  m[4] = "four";
+  ASSERT_EQ(m.at(4), "four");
+  ASSERT_FALSE(m.insert(4, "again").second);
+  ASSERT_EQ(m.at(4), "four");
+  ASSERT_FALSE(m.insert_or_assign(4, "FOUR").second);
+  ASSERT_EQ(m.at(4), "FOUR");
+  auto result = m.emplace(0, "zero");
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ((*result.first).second, "zero");
+  ASSERT_EQ(m.begin()->first, 0);
+  m.erase(m.find(2));
+  m.erase(m.end());
+  ASSERT_EQ(m.erase(2), 0u);
+  ASSERT_EQ(m.erase(3), 1u);
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.count(4), 1u);
+}
+
+TEST(TestBTreeMap, EmptyMap) {
+  s21::BTreeMap<int, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.begin() == m.end());
+  ASSERT_TRUE(m.find(1) == m.end());
+  ASSERT_TRUE(m.lower_bound(1) == m.end());
+  ASSERT_EQ(m.erase(1), 0u);
+  m[1] = 10;
+  m.erase(m.begin());
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.begin() == m.end());
+  m[2] = 20;
+  ASSERT_EQ(m.begin()->second, 20);
+}
+
+TEST(TestBTreeMap, RandomOperationsMatchStdMap) {
+  s21::BTreeMap<int, int> m;
+  std::map<int, int> expected;
+  std::mt19937 rng(21);
+  std::uniform_int_distribution<int> key(0, 30000);
+  for (int step = 0; step < 200000; ++step) {
+    int k = key(rng);
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        ASSERT_EQ(m.insert(k, step).second, expected.insert({k, step}).second);
+        break;
+      case 2:
+        ASSERT_EQ(m.erase(k), expected.erase(k));
+        break;
+      default:
+        ASSERT_EQ(m.contains(k), expected.count(k) == 1);
+        break;
+    }
+  }
+  ExpectSameElements(m, expected);
+  for (int k = -1; k <= 30001; k += 7) {
+    auto lower = m.lower_bound(k);
+    auto expected_lower = expected.lower_bound(k);
+    if (expected_lower == expected.end()) {
+      ASSERT_TRUE(lower == m.end());
+    } else {
+      ASSERT_EQ(lower->first, expected_lower->first);
+    }
+    auto upper = m.upper_bound(k);
+    auto expected_upper = expected.upper_bound(k);
+    if (expected_upper == expected.end()) {
+      ASSERT_TRUE(upper == m.end());
+    } else {
+      ASSERT_EQ(upper->first, expected_upper->first);
+    }
+  }
+  for (auto it = expected.begin(); it != expected.end();) {
+    ASSERT_EQ(m.erase(it->first), 1u);
+    it = expected.erase(it);
+    if (expected.size() % 1000 == 0) {
+      ExpectSameElements(m, expected);
+    }
+  }
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(TestBTreeMap, StringKeysBuildDeepTrees) {
+  s21::BTreeMap<std::string, std::string> m;
+  std::map<std::string, std::string> expected;
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = "key." + std::to_string(i * 7919 % 3001);
+    m[key] = key + ".value";
+    expected[key] = key + ".value";
+  }
+  ExpectSameElements(m, expected);
+  // erasing by a reference into the map itself
+  while (m.size() > 100) {
+    auto it = m.begin();
+    for (int i = 0; i < 5 && it != m.end(); ++i) {
+      ++it;
+    }
+    if (it == m.end()) {
+      it = m.begin();
+    }
+    expected.erase(it->first);
+    ASSERT_EQ(m.erase(it->first), 1u);
+  }
+  ExpectSameElements(m, expected);
+}
+
+TEST(TestBTreeMap, CopyMoveSwap) {
+  s21::BTreeMap<int, std::string> m;
+  for (int i = 0; i < 5000; ++i) {
+    m.insert(i, std::to_string(i));
+  }
+  s21::BTreeMap<int, std::string> copy(m);
+  copy[0] = "changed";
+  ASSERT_EQ(m.at(0), "0");
+  ASSERT_EQ(copy.size(), 5000u);
+  ASSERT_EQ((--copy.end())->second, "4999");
+  s21::BTreeMap<int, std::string> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.at(0), "changed");
+  s21::BTreeMap<int, std::string> assigned;
+  assigned = m;
+  ASSERT_EQ(assigned.size(), m.size());
+  assigned = std::move(moved);
+  ASSERT_EQ(assigned.at(0), "changed");
+  assigned.swap(m);
+  ASSERT_EQ(m.at(0), "changed");
+  ASSERT_EQ(assigned.at(0), "0");
+  const s21::BTreeMap<int, std::string> &view = assigned;
+  ASSERT_EQ(view.at(4999), "4999");
+  ASSERT_TRUE(view.find(5000) == view.end());
+}
+
+TEST(TestBTreeMap, MergeKeepsExistingKeys) {
+  s21::BTreeMap<int, int> a{{1, 1}, {3, 3}};
+  s21::BTreeMap<int, int> b{{1, 10}, {2, 20}, {4, 40}};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.at(1), 1);
+  ASSERT_EQ(a.at(2), 20);
+  ASSERT_EQ(b.size(), 1u);
+  ASSERT_EQ(b.at(1), 10);
+}
+
+TEST(TestBTreeMap, FailedCopyLeaksNothing) {
+  s21::BTreeMap<int, Fragile> m;
+  for (int i = 0; i < 2000; ++i) {
+    m.emplace(i, Fragile(i));
+  }
+  Fragile::copies_left = 1500;
+  using FragileMap = s21::BTreeMap<int, Fragile>;
+  ASSERT_THROW(FragileMap failed(m), std::runtime_error);
+  Fragile::copies_left = -1;
+  s21::BTreeMap<int, Fragile> copy(m);
+  ASSERT_EQ(copy.at(1999).value, 1999);
+}
+
+TEST(TestBTreeMap, InsertAndEraseDescendOnce) {
+  s21::BTreeMap<int, int, CountingLess> m;
+  for (int i = 0; i < 100000; i += 2) {
+    m.insert(i, i);
+  }
+  // the leaf of 50001 has room for it and stays above its minimum after it,
+  // so each call below walks from the root to that leaf once
+  long lookup = ComparisonsIn([&] { m.find(50001); });
+  ASSERT_GT(lookup, 0);
+  EXPECT_LE(ComparisonsIn([&] { ASSERT_TRUE(m.insert(50001, 1).second); }),
+            lookup + 1);
+  EXPECT_LE(ComparisonsIn([&] { ASSERT_FALSE(m.insert(50001, 2).second); }),
+            lookup + 1);
+  EXPECT_LE(ComparisonsIn([&] { ASSERT_EQ(m.erase(50001), 1u); }),
+            lookup + 1);
+  EXPECT_LE(ComparisonsIn([&] { ASSERT_EQ(m.erase(50001), 0u); }),
+            lookup + 1);
+  ASSERT_EQ(m.size(), 50000u);
+}
@@ -0,0 +1,386 @@
+#ifndef S21_CACHE_H_
+#define S21_CACHE_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../allocator/s21_pool_allocator.h"
+#include "../list/s21_list.h"
+#include "../unordered/s21_unordered_map.h"
+
+namespace s21 {
+
+// Counters shared by the caches. A lookup through get() is a hit or a miss;
+// an eviction is an entry dropped to make room, not one removed by erase().
+struct CacheStats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+};
+
+// One cached entry. Its charge is what it counts against the capacity: 1 per
+// entry by default, or its size in bytes if the caller passes that to put().
+template <typename Key, typename Value>
+struct CacheEntry {
+  template <typename V>
+  CacheEntry(const Key &k, V &&v, size_t c, size_t f)
+      : key(k), value(std::forward<V>(v)), charge(c), frequency(f) {}
+
+  Key key;
+  Value value;
+  size_t charge;
+  size_t frequency;
+};
+
+// Common state of LruCache and LfuCache: the entries sit in one s21::list
+// whose nodes come from a PoolAllocator, and an open-addressed UnorderedMap
+// finds an entry's node by key. Moving an entry within the list is a splice
+// of its node, so a lookup costs one hash probe and a few pointer writes, and
+// once the pool is warm nothing allocates per operation. Cache is the
+// derived class, which supplies Unlink() and OnClear() for its policy.
+template <typename Cache, typename Key, typename Value, typename Hash,
+          typename KeyEqual>
+class CacheBase {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+  using entry_type = CacheEntry<Key, Value>;
+  // called with each evicted entry just before it is destroyed; the value
+  // may be moved out, but the cache itself must not be touched
+  using eviction_callback = std::function<void(const Key &, Value &)>;
+
+  // Returns the value, or nullptr, without counting a lookup or promoting
+  // the entry.
+  const Value *peek(const Key &key) const {
+    auto found = index_.find(key);
+    if (found == index_.cend()) {
+      return nullptr;
+    }
+    iterator entry = (*found).second;
+    return &(*entry).value;
+  }
+
+  bool contains(const Key &key) const { return index_.contains(key); }
+
+  bool empty() const noexcept { return index_.empty(); }
+  size_type size() const noexcept { return index_.size(); }
+  size_type capacity() const noexcept { return capacity_; }
+  // sum of the charges of the cached entries
+  size_type charge() const noexcept { return charge_; }
+
+  const CacheStats &stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = CacheStats(); }
+
+  void set_eviction_callback(eviction_callback on_evict) {
+    on_evict_ = std::move(on_evict);
+  }
+
+  // Removes key without calling the eviction callback.
+  bool erase(const Key &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return false;
+    }
+    iterator entry = (*found).second;
+    index_.erase(found);
+    self().Unlink(entry);
+    charge_ -= (*entry).charge;
+    entries_.erase(entry);
+    return true;
+  }
+
+  void clear() {
+    index_.clear();
+    entries_.clear();
+    charge_ = 0;
+    self().OnClear();
+  }
+
+ protected:
+  using List = s21::list<entry_type, PoolAllocator<entry_type>>;
+  using iterator = typename List::iterator;
+  using const_iterator = typename List::const_iterator;
+
+  CacheBase(size_type capacity, eviction_callback on_evict)
+      : capacity_(capacity), charge_(0), on_evict_(std::move(on_evict)) {
+    if (capacity == 0) {
+      throw std::invalid_argument("cache capacity must be positive");
+    }
+  }
+
+  ~CacheBase() = default;
+
+  Cache &self() noexcept { return static_cast<Cache &>(*this); }
+
+  static const_iterator Const(iterator it) noexcept {
+    return const_iterator(it.get_node());
+  }
+
+  // the entry after it, or an empty iterator past the last one
+  static iterator Next(iterator it) noexcept { return ++it; }
+
+  // Drops the victims chosen by next_victim until extra more charge fits.
+  template <typename NextVictim>
+  void MakeRoom(size_type extra, NextVictim next_victim) {
+    while (charge_ + extra > capacity_ && !empty()) {
+      iterator victim = next_victim();
+      if (victim.get_node() == nullptr) {
+        return;
+      }
+      Evict(victim);
+    }
+  }
+
+  void Evict(iterator victim) {
+    entry_type &entry = *victim;
+    index_.erase(entry.key);
+    self().Unlink(victim);
+    charge_ -= entry.charge;
+    ++stats_.evictions;
+    if (on_evict_) {
+      on_evict_(entry.key, entry.value);
+    }
+    entries_.erase(victim);
+  }
+
+  // Builds the entry before pos, or last if pos is empty, and indexes it;
+  // on failure nothing stays. The entry is built at the back and spliced
+  // into place, since s21::list::emplace() cannot insert before the last
+  // node.
+  template <typename V>
+  iterator Emplace(const_iterator pos, const Key &key, V &&value,
+                   size_type charge, size_type frequency) {
+    entries_.emplace_back(key, std::forward<V>(value), charge, frequency);
+    iterator entry = entries_.end();
+    entries_.splice(pos, entries_, Const(entry));
+    try {
+      index_.insert(key, entry);
+    } catch (...) {
+      entries_.erase(entry);
+      throw;
+    }
+    charge_ += charge;
+    return entry;
+  }
+
+  size_type capacity_;
+  size_type charge_;
+  CacheStats stats_;
+  eviction_callback on_evict_;
+  List entries_;
+  UnorderedMap<Key, iterator, Hash, KeyEqual> index_;
+};
+
+// Least recently used cache: get() and put() move the entry to the front of
+// the list, and eviction takes entries from the back. Every operation is
+// O(1). An entry whose charge exceeds the capacity is not cached.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class LruCache : public CacheBase<LruCache<Key, Value, Hash, KeyEqual>, Key,
+                                  Value, Hash, KeyEqual> {
+  using Base = CacheBase<LruCache, Key, Value, Hash, KeyEqual>;
+  using typename Base::iterator;
+  friend Base;
+
+ public:
+  using typename Base::eviction_callback;
+  using typename Base::size_type;
+
+  explicit LruCache(size_type capacity, eviction_callback on_evict = nullptr)
+      : Base(capacity, std::move(on_evict)) {}
+
+  LruCache(const LruCache &) = delete;
+  LruCache &operator=(const LruCache &) = delete;
+
+  // The cached value, promoted to most recently used, or nullptr.
+  Value *get(const Key &key) {
+    auto found = this->index_.find(key);
+    if (found == this->index_.end()) {
+      ++this->stats_.misses;
+      return nullptr;
+    }
+    ++this->stats_.hits;
+    iterator entry = (*found).second;
+    Promote(entry);
+    return &(*entry).value;
+  }
+
+  // Inserts or replaces key and makes it the most recently used entry,
+  // evicting from the least recently used end until it fits. Returns false,
+  // and leaves the cache as it was, if charge alone exceeds the capacity.
+  template <typename V>
+  bool put(const Key &key, V &&value, size_type charge = 1) {
+    if (charge > this->capacity_) {
+      return false;
+    }
+    auto found = this->index_.find(key);
+    if (found != this->index_.end()) {
+      iterator entry = (*found).second;
+      (*entry).value = std::forward<V>(value);
+      this->charge_ = this->charge_ - (*entry).charge + charge;
+      (*entry).charge = charge;
+      Promote(entry);
+      this->MakeRoom(0, [this] { return Victim(); });
+      return true;
+    }
+    this->MakeRoom(charge, [this] { return Victim(); });
+    this->Emplace(this->entries_.c_begin(), key, std::forward<V>(value), charge,
+                  1);
+    return true;
+  }
+
+  // Lowers the capacity, evicting as needed, or raises it.
+  void set_capacity(size_type capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("cache capacity must be positive");
+    }
+    this->capacity_ = capacity;
+    this->MakeRoom(0, [this] { return Victim(); });
+  }
+
+ private:
+  void Promote(iterator entry) {
+    this->entries_.splice(this->entries_.c_begin(), this->entries_,
+                          Base::Const(entry));
+  }
+
+  // the least recently used entry; s21::list::end() is the last node
+  iterator Victim() { return this->entries_.end(); }
+
+  // the list order is all the state LRU keeps
+  void Unlink(iterator) noexcept {}
+  void OnClear() noexcept {}
+};
+
+// Least frequently used cache, with ties broken by least recent use. The
+// list is kept sorted by use count, and within one count by recency, so
+// eviction takes the front entry. tails_ maps each count in use to the most
+// recent entry with that count; a hit moves the entry to just after the
+// tail of the next count, so get(), put() and eviction are all O(1).
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class LfuCache : public CacheBase<LfuCache<Key, Value, Hash, KeyEqual>, Key,
+                                  Value, Hash, KeyEqual> {
+  using Base = CacheBase<LfuCache, Key, Value, Hash, KeyEqual>;
+  using typename Base::iterator;
+  friend Base;
+
+ public:
+  using typename Base::eviction_callback;
+  using typename Base::size_type;
+
+  explicit LfuCache(size_type capacity, eviction_callback on_evict = nullptr)
+      : Base(capacity, std::move(on_evict)) {}
+
+  LfuCache(const LfuCache &) = delete;
+  LfuCache &operator=(const LfuCache &) = delete;
+
+  // The cached value, with its use count raised, or nullptr.
+  Value *get(const Key &key) {
+    auto found = this->index_.find(key);
+    if (found == this->index_.end()) {
+      ++this->stats_.misses;
+      return nullptr;
+    }
+    ++this->stats_.hits;
+    iterator entry = (*found).second;
+    Touch(entry);
+    return &(*entry).value;
+  }
+
+  // Inserts key with a use count of one, or replaces its value and counts a
+  // use. Evicts the least frequently used entries until it fits; returns
+  // false, leaving the cache as it was, if charge alone exceeds the capacity.
+  template <typename V>
+  bool put(const Key &key, V &&value, size_type charge = 1) {
+    if (charge > this->capacity_) {
+      return false;
+    }
+    auto found = this->index_.find(key);
+    if (found != this->index_.end()) {
+      iterator entry = (*found).second;
+      (*entry).value = std::forward<V>(value);
+      this->charge_ = this->charge_ - (*entry).charge + charge;
+      (*entry).charge = charge;
+      Touch(entry);
+      this->MakeRoom(0, [this, entry] { return VictimOtherThan(entry); });
+      return true;
+    }
+    this->MakeRoom(charge, [this] { return this->entries_.begin(); });
+    // new entries go after the other entries used once
+    auto tail = tails_.find(1);
+    iterator pos = tail == tails_.end() ? this->entries_.begin()
+                                        : Base::Next((*tail).second);
+    iterator entry = this->Emplace(Base::Const(pos), key,
+                                   std::forward<V>(value), charge, 1);
+    tails_.insert_or_assign(1, entry);
+    return true;
+  }
+
+  // The use count of key, 0 if it is not cached.
+  size_type frequency(const Key &key) const {
+    auto found = this->index_.find(key);
+    if (found == this->index_.cend()) {
+      return 0;
+    }
+    iterator entry = (*found).second;
+    return (*entry).frequency;
+  }
+
+  void set_capacity(size_type capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("cache capacity must be positive");
+    }
+    this->capacity_ = capacity;
+    this->MakeRoom(0, [this] { return this->entries_.begin(); });
+  }
+
+ private:
+  UnorderedMap<size_type, iterator> tails_;
+
+  // Raises the use count of entry and moves it to the end of its new group.
+  void Touch(iterator entry) {
+    size_type frequency = (*entry).frequency;
+    auto next_tail = tails_.find(frequency + 1);
+    // the group of frequency + 1, if any, directly follows this one
+    iterator after = next_tail != tails_.end()
+                         ? (*next_tail).second
+                         : (*tails_.find(frequency)).second;
+    Unlink(entry);
+    if (after != entry) {
+      this->entries_.splice(Base::Const(Base::Next(after)), this->entries_,
+                            Base::Const(entry));
+    }
+    (*entry).frequency = frequency + 1;
+    tails_.insert_or_assign(frequency + 1, entry);
+  }
+
+  // the front entry, or the one after it if the front is keep
+  iterator VictimOtherThan(iterator keep) {
+    iterator victim = this->entries_.begin();
+    return victim == keep ? Base::Next(victim) : victim;
+  }
+
+  // Drops entry from tails_ while it is still in place in the list.
+  void Unlink(iterator entry) {
+    size_type frequency = (*entry).frequency;
+    auto tail = tails_.find(frequency);
+    if ((*tail).second != entry) {
+      return;
+    }
+    iterator prev = entry;
+    if (entry != this->entries_.begin() && (*--prev).frequency == frequency) {
+      (*tail).second = prev;
+    } else {
+      tails_.erase(tail);
+    }
+  }
+
+  void OnClear() noexcept { tails_.clear(); }
+};
+
+}  // namespace s21
+
+#endif  // S21_CACHE_H_
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+// Reference model of both caches: every entry remembers its use count and
+// the step of its last use, and the victim is found by scanning. LRU evicts
+// the oldest last use; LFU the lowest count, then the oldest last use.
+class ModelCache {
+ public:
+  ModelCache(size_t capacity, bool lfu) : capacity_(capacity), lfu_(lfu) {}
+
+  const int *get(int key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    Use(it->second);
+    return &it->second.value;
+  }
+
+  void put(int key, int value, size_t charge, std::vector<int> &evicted) {
+    if (charge > capacity_) {
+      return;
+    }
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      charge_ = charge_ - it->second.charge + charge;
+      it->second.value = value;
+      it->second.charge = charge;
+      Use(it->second);
+      MakeRoom(0, key, evicted);
+      return;
+    }
+    MakeRoom(charge, key, evicted);
+    entries_[key] = Entry{value, charge, 1, ++step_};
+    charge_ += charge;
+  }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    int value;
+    size_t charge;
+    size_t uses;
+    size_t last_use;
+  };
+
+  void Use(Entry &entry) {
+    ++entry.uses;
+    entry.last_use = ++step_;
+  }
+
+  void MakeRoom(size_t extra, int keep, std::vector<int> &evicted) {
+    while (charge_ + extra > capacity_) {
+      auto victim = entries_.end();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->first != keep &&
+            (victim == entries_.end() || Before(it->second, victim->second))) {
+          victim = it;
+        }
+      }
+      evicted.push_back(victim->first);
+      charge_ -= victim->second.charge;
+      entries_.erase(victim);
+    }
+  }
+
+  bool Before(const Entry &a, const Entry &b) const {
+    if (lfu_ && a.uses != b.uses) {
+      return a.uses < b.uses;
+    }
+    return a.last_use < b.last_use;
+  }
+
+  size_t capacity_;
+  bool lfu_;
+  size_t charge_ = 0;
+  size_t step_ = 0;
+  std::map<int, Entry> entries_;
+};
+
+template <typename Cache>
+void RunAgainstModel(bool lfu, unsigned seed) {
+  std::vector<int> evicted;
+  Cache cache(50,
+              [&evicted](const int &key, int &) { evicted.push_back(key); });
+  ModelCache model(50, lfu);
+  std::vector<int> expected_evicted;
+  std::mt19937 rng(seed);
+  for (int step = 0; step < 50000; ++step) {
+    int key = static_cast<int>(rng() % 120);
+    if (rng() % 3 == 0) {
+      const int *expected = model.get(key);
+      const int *got = cache.get(key);
+      ASSERT_EQ(got == nullptr, expected == nullptr) << "step " << step;
+      if (got != nullptr) {
+        ASSERT_EQ(*got, *expected);
+      }
+    } else {
+      size_t charge = 1 + rng() % 4;
+      model.put(key, step, charge, expected_evicted);
+      cache.put(key, step, charge);
+    }
+    ASSERT_EQ(evicted, expected_evicted) << "step " << step;
+    ASSERT_EQ(cache.size(), model.size());
+    ASSERT_LE(cache.charge(), cache.capacity());
+  }
+  ASSERT_EQ(cache.stats().evictions, evicted.size());
+}
+
+}  // namespace
+
+TEST(LruCache, EvictsLeastRecentlyUsed) {
+  std::vector<std::string> evicted;
+  s21::LruCache<std::string, int> cache(
+      2, [&evicted](const std::string &key, int &) { evicted.push_back(key); });
+  ASSERT_TRUE(cache.put("a", 1));
+  ASSERT_TRUE(cache.put("b", 2));
+  ASSERT_EQ(*cache.get("a"), 1);
+  cache.put("c", 3);
+  ASSERT_EQ(evicted, (std::vector<std::string>{"b"}));
+  ASSERT_EQ(cache.get("b"), nullptr);
+  ASSERT_TRUE(cache.contains("a"));
+  ASSERT_TRUE(cache.contains("c"));
+  // peek neither counts nor promotes
+  ASSERT_EQ(*cache.peek("a"), 1);
+  cache.put("d", 4);
+  ASSERT_EQ(evicted, (std::vector<std::string>{"b", "a"}));
+  ASSERT_EQ(cache.stats().hits, 1u);
+  ASSERT_EQ(cache.stats().misses, 1u);
+  ASSERT_EQ(cache.stats().evictions, 2u);
+  cache.reset_stats();
+  ASSERT_EQ(cache.stats().hits, 0u);
+  ASSERT_THROW((s21::LruCache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(LruCache, CapacityInBytes) {
+  s21::LruCache<int, std::string> cache(100);
+  ASSERT_TRUE(cache.put(1, std::string(40, 'a'), 40));
+  ASSERT_TRUE(cache.put(2, std::string(40, 'b'), 40));
+  ASSERT_EQ(cache.charge(), 80u);
+  ASSERT_FALSE(cache.put(3, std::string(101, 'c'), 101));
+  ASSERT_EQ(cache.size(), 2u);
+  // growing entry 1 pushes out entry 2, never entry 1 itself
+  ASSERT_TRUE(cache.put(1, std::string(90, 'a'), 90));
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_EQ(cache.charge(), 90u);
+  ASSERT_EQ(cache.get(1)->size(), 90u);
+  cache.set_capacity(50);
+  ASSERT_TRUE(cache.empty());
+  ASSERT_EQ(cache.charge(), 0u);
+  ASSERT_TRUE(cache.put(3, "c", 1));
+  ASSERT_TRUE(cache.erase(3));
+  ASSERT_FALSE(cache.erase(3));
+  ASSERT_EQ(cache.stats().evictions, 2u);
+}
+
+TEST(LruCache, MoveOnlyValuesAndCallbackTakesValue) {
+  std::vector<std::unique_ptr<int>> spilled;
+  s21::LruCache<int, std::unique_ptr<int>> cache(
+      1, [&spilled](const int &, std::unique_ptr<int> &value) {
+        spilled.push_back(std::move(value));
+      });
+  cache.put(1, std::make_unique<int>(10));
+  cache.put(2, std::make_unique<int>(20));
+  ASSERT_EQ(spilled.size(), 1u);
+  ASSERT_EQ(*spilled[0], 10);
+  ASSERT_EQ(**cache.get(2), 20);
+  cache.clear();
+  ASSERT_TRUE(cache.empty());
+  cache.put(3, std::make_unique<int>(30));
+  ASSERT_EQ(**cache.get(3), 30);
+}
+
+TEST(LruCache, MatchesModel) {
+  RunAgainstModel<s21::LruCache<int, int>>(false, 25);
+}
+
+TEST(LfuCache, EvictsLeastFrequentlyUsed) {
+  std::vector<int> evicted;
+  s21::LfuCache<int, int> cache(
+      3, [&evicted](const int &key, int &) { evicted.push_back(key); });
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(3, 30);
+  cache.get(1);
+  cache.get(1);
+  cache.get(2);
+  ASSERT_EQ(cache.frequency(1), 3u);
+  ASSERT_EQ(cache.frequency(2), 2u);
+  ASSERT_EQ(cache.frequency(3), 1u);
+  ASSERT_EQ(cache.frequency(4), 0u);
+  cache.put(4, 40);
+  ASSERT_EQ(evicted, (std::vector<int>{3}));
+  // 4 and 5 both have one use; 4 is the older
+  cache.put(5, 50);
+  ASSERT_EQ(evicted, (std::vector<int>{3, 4}));
+  cache.get(5);
+  cache.get(5);
+  // 5 has three uses now and 2 has two, so 2 goes next
+  cache.put(6, 60);
+  ASSERT_EQ(evicted, (std::vector<int>{3, 4, 2}));
+  ASSERT_TRUE(cache.erase(6));
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_EQ(*cache.peek(1), 10);
+  cache.clear();
+  ASSERT_TRUE(cache.empty());
+  cache.put(7, 70);
+  ASSERT_EQ(cache.frequency(7), 1u);
+}
+
+TEST(LfuCache, ReplacingKeepsTheEntry) {
+  s21::LfuCache<int, int> cache(4);
+  cache.put(1, 1, 2);
+  cache.put(2, 2, 2);
+  // 1 is the least used, but it is the entry being replaced
+  ASSERT_TRUE(cache.put(1, 100, 3));
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_EQ(*cache.get(1), 100);
+  ASSERT_EQ(cache.frequency(1), 3u);
+  cache.set_capacity(2);
+  ASSERT_TRUE(cache.empty());
+}
+
+TEST(LfuCache, MatchesModel) {
+  RunAgainstModel<s21::LfuCache<int, int>>(true, 25);
+  RunAgainstModel<s21::LfuCache<int, int>>(true, 26);
+}
@@ -0,0 +1,73 @@
+#ifndef _FLAT_SEARCH_H_
+#define _FLAT_SEARCH_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// Binary search over a sorted array without data-dependent branches. The
+// answer lies in [base, base + len]; every step compares one element and
+// moves base by either 0 or half, which compiles to a multiply or a cmov
+// instead of a jump the CPU would mispredict half of the time. The loop
+// runs exactly ceil(log2(n)) times whatever the key, and since both
+// candidates for the next step are known before the compare, both are
+// prefetched: on arrays bigger than the cache the misses of consecutive
+// steps overlap instead of queueing behind each other. Arrays that fit in
+// L2 are searched without it; there the extra instructions only cost.
+
+constexpr size_t kFlatPrefetchBytes = 256 * 1024;
+
+template <typename Key>
+inline void Prefetch(const Key *ptr) noexcept {
+  __builtin_prefetch(ptr);
+}
+
+// index of the first element not less than key
+template <typename Key, typename K, typename Compare>
+size_t FlatLowerBound(const Key *keys, size_t n, const K &key,
+                      const Compare &compare) {
+  if (n == 0) {
+    return 0;
+  }
+  const Key *base = keys;
+  size_t len = n;
+  const bool prefetch = n * sizeof(Key) > kFlatPrefetchBytes;
+  while (len > 1) {
+    size_t half = len / 2;
+    len -= half;
+    if (prefetch) {
+      Prefetch(base + len / 2 - 1);
+      Prefetch(base + half + len / 2 - 1);
+    }
+    base += static_cast<size_t>(compare(base[half - 1], key)) * half;
+  }
+  return static_cast<size_t>(base - keys) +
+         static_cast<size_t>(compare(*base, key));
+}
+
+// index of the first element greater than key
+template <typename Key, typename K, typename Compare>
+size_t FlatUpperBound(const Key *keys, size_t n, const K &key,
+                      const Compare &compare) {
+  if (n == 0) {
+    return 0;
+  }
+  const Key *base = keys;
+  size_t len = n;
+  const bool prefetch = n * sizeof(Key) > kFlatPrefetchBytes;
+  while (len > 1) {
+    size_t half = len / 2;
+    len -= half;
+    if (prefetch) {
+      Prefetch(base + len / 2 - 1);
+      Prefetch(base + half + len / 2 - 1);
+    }
+    base += static_cast<size_t>(!compare(key, base[half - 1])) * half;
+  }
+  return static_cast<size_t>(base - keys) +
+         static_cast<size_t>(!compare(key, *base));
+}
+
+}  // namespace s21
+
+#endif  // _FLAT_SEARCH_H_
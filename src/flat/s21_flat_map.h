@@ -0,0 +1,481 @@
+#ifndef _FLAT_MAP_H_
+#define _FLAT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "flat_search.h"
+
+namespace s21 {
+
+template <typename Key, typename T, bool IsConst>
+class FlatMapIterator;
+
+// Sorted map kept as two parallel s21::Vectors, keys and values, with no
+// per-element node. Lookups binary-search the key array only, branch-free
+// (flat_search.h), so a search touches log2(n) keys that sit next to each
+// other instead of log2(n) scattered nodes. Building from a range sorts and
+// drops duplicates once; single insertions and erasures shift the tail and
+// cost O(n), so the map suits tables that are built once and read many
+// times. Iterators and references are invalidated by any modification.
+//
+// Since keys and values live apart, *it is a pair of references,
+// std::pair<const Key &, T &>, rather than a reference to a stored pair.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<T>>
+class FlatMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using key_compare = Compare;
+  using value_type = std::pair<Key, T>;
+  using reference = std::pair<const Key &, T &>;
+  using const_reference = std::pair<const Key &, const T &>;
+  using allocator_type = Alloc;
+  using iterator = FlatMapIterator<Key, T, false>;
+  using const_iterator = FlatMapIterator<Key, T, true>;
+  using size_type = size_t;
+  using key_container_type =
+      Vector<Key,
+             typename std::allocator_traits<Alloc>::template rebind_alloc<Key>>;
+  using mapped_container_type = Vector<T, Alloc>;
+
+  FlatMap() : keys_(), values_(), compare_() {}
+
+  FlatMap(std::initializer_list<value_type> const &items) : FlatMap() {
+    Build(items.begin(), items.end());
+  }
+
+  // sorts [first, last) once; of equal keys the first one is kept
+  template <typename InputIt>
+  FlatMap(InputIt first, InputIt last) : FlatMap() {
+    Build(first, last);
+  }
+
+  FlatMap(const FlatMap &other) = default;
+  FlatMap(FlatMap &&other) = default;
+  FlatMap &operator=(const FlatMap &other) = default;
+  FlatMap &operator=(FlatMap &&other) = default;
+  ~FlatMap() = default;
+
+  T &at(const Key &key) {
+    size_type index = FindIndex(key);
+    if (index == size()) {
+      throw std::out_of_range("error");
+    }
+    return values_[index];
+  }
+
+  const T &at(const Key &key) const {
+    size_type index = FindIndex(key);
+    if (index == size()) {
+      throw std::out_of_range("error");
+    }
+    return values_.data()[index];
+  }
+
+  T &operator[](const key_type &key) {
+    return values_[TryEmplace(key).first];
+  }
+
+  iterator begin() noexcept { return iterator(keys_.data(), values_.data()); }
+
+  iterator end() noexcept {
+    return iterator(keys_.data() + size(), values_.data() + size());
+  }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept {
+    return const_iterator(keys_.data(), values_.data());
+  }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(keys_.data() + size(), values_.data() + size());
+  }
+
+  bool empty() const noexcept { return keys_.empty(); }
+
+  size_type size() const noexcept { return keys_.size(); }
+
+  size_type max_size() const noexcept {
+    return std::min(keys_.max_size(), values_.max_size());
+  }
+
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  // the sorted keys and, at the same indices, their values
+  const key_container_type &keys() const noexcept { return keys_; }
+
+  const mapped_container_type &values() const noexcept { return values_; }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return TryEmplaceAt(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return TryEmplaceAt(value.first, std::move(value.second));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return TryEmplaceAt(key, obj);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto result = TryEmplaceAt(key, obj);
+    if (!result.second) {
+      (*result.first).second = obj;
+    }
+    return result;
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             mapped_type &&obj) {
+    auto result = TryEmplaceAt(key, std::move(obj));
+    if (!result.second) {
+      (*result.first).second = std::move(obj);
+    }
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  void erase(const_iterator pos) {
+    size_type index = IndexOf(pos);
+    if (index >= size()) {
+      return;
+    }
+    EraseAt(index);
+  }
+
+  size_type erase(const key_type &key) {
+    size_type index = FindIndex(key);
+    if (index == size()) {
+      return 0;
+    }
+    EraseAt(index);
+    return 1;
+  }
+
+  void swap(FlatMap &other) {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(compare_, other.compare_);
+  }
+
+  // Moves in the elements of other whose keys are not here yet, walking the
+  // two sorted runs once. The result is built in new arrays that replace the
+  // old ones only when complete, and elements whose move may throw are
+  // copied, so an exception leaves both maps as they were.
+  void merge(FlatMap &other) {
+    if (this == &other) {
+      return;
+    }
+    key_container_type keys;
+    mapped_container_type values;
+    key_container_type rest_keys;
+    mapped_container_type rest_values;
+    keys.reserve(size() + other.size());
+    values.reserve(size() + other.size());
+    rest_keys.reserve(other.size());
+    rest_values.reserve(other.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() || j < other.size()) {
+      if (j == other.size() ||
+          (i < size() && compare_(keys_[i], other.keys_[j]))) {
+        keys.push_back(std::move_if_noexcept(keys_[i]));
+        values.push_back(std::move_if_noexcept(values_[i]));
+        ++i;
+        continue;
+      }
+      if (i == size() || compare_(other.keys_[j], keys_[i])) {
+        keys.push_back(std::move_if_noexcept(other.keys_[j]));
+        values.push_back(std::move_if_noexcept(other.values_[j]));
+      } else {
+        rest_keys.push_back(std::move_if_noexcept(other.keys_[j]));
+        rest_values.push_back(std::move_if_noexcept(other.values_[j]));
+      }
+      ++j;
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+    other.keys_.swap(rest_keys);
+    other.values_.swap(rest_values);
+  }
+
+  bool contains(const Key &key) const { return FindIndex(key) != size(); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return FindIndex(key) != size();
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  iterator find(const key_type &key) { return begin() + FindIndex(key); }
+
+  const_iterator find(const key_type &key) const {
+    return cbegin() + FindIndex(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return begin() + FindIndex(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return cbegin() + FindIndex(key);
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return begin() + LowerBoundIndex(key);
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return cbegin() + LowerBoundIndex(key);
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return begin() + UpperBoundIndex(key);
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return cbegin() + UpperBoundIndex(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ private:
+  template <typename K>
+  size_type LowerBoundIndex(const K &key) const {
+    return FlatLowerBound(keys_.data(), size(), key, compare_);
+  }
+
+  template <typename K>
+  size_type UpperBoundIndex(const K &key) const {
+    return FlatUpperBound(keys_.data(), size(), key, compare_);
+  }
+
+  // index of key, or size() if absent
+  template <typename K>
+  size_type FindIndex(const K &key) const {
+    size_type index = LowerBoundIndex(key);
+    if (index != size() && compare_(key, keys_.data()[index])) {
+      index = size();
+    }
+    return index;
+  }
+
+  size_type IndexOf(const_iterator pos) const noexcept {
+    return static_cast<size_type>(pos - cbegin());
+  }
+
+  // (index of key, true if it was inserted with a value built from args)
+  template <typename... Args>
+  std::pair<size_type, bool> TryEmplace(const key_type &key, Args &&...args) {
+    size_type index = LowerBoundIndex(key);
+    if (index != size() && !compare_(key, keys_.data()[index])) {
+      return {index, false};
+    }
+    // key may refer into keys_, which the insertion shifts
+    key_type copy(key);
+    values_.emplace(
+        typename mapped_container_type::iterator(values_.data() + index),
+        std::forward<Args>(args)...);
+    try {
+      keys_.insert(typename key_container_type::iterator(keys_.data() + index),
+                   std::move(copy));
+    } catch (...) {
+      values_.erase(
+          typename mapped_container_type::iterator(values_.data() + index));
+      throw;
+    }
+    return {index, true};
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> TryEmplaceAt(const key_type &key, Args &&...args) {
+    auto result = TryEmplace(key, std::forward<Args>(args)...);
+    return {begin() + result.first, result.second};
+  }
+
+  void EraseAt(size_type index) {
+    keys_.erase(typename key_container_type::iterator(keys_.data() + index));
+    values_.erase(
+        typename mapped_container_type::iterator(values_.data() + index));
+  }
+
+  template <typename InputIt>
+  void Build(InputIt first, InputIt last) {
+    Vector<value_type> items;
+    for (; first != last; ++first) {
+      items.push_back(*first);
+    }
+    BuildSorted(items);
+  }
+
+  // stable sort, so that of equal keys the one that came first survives
+  void BuildSorted(Vector<value_type> &items) {
+    value_type *data = items.data();
+    std::stable_sort(data, data + items.size(),
+                     [this](const value_type &a, const value_type &b) {
+                       return compare_(a.first, b.first);
+                     });
+    reserve(items.size());
+    for (size_type i = 0; i < items.size(); ++i) {
+      if (i != 0 && !compare_(data[i - 1].first, data[i].first)) {
+        continue;
+      }
+      keys_.push_back(std::move(data[i].first));
+      values_.push_back(std::move(data[i].second));
+    }
+  }
+
+  key_container_type keys_;
+  mapped_container_type values_;
+  Compare compare_;
+};
+
+// Random-access iterator over FlatMap: a key pointer and a value pointer
+// moved in step. Dereferencing yields a pair of references.
+template <typename Key, typename T, bool IsConst>
+class FlatMapIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using mapped_pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference =
+      std::pair<const Key &, std::conditional_t<IsConst, const T &, T &>>;
+
+  // what operator-> returns: holds the pair of references
+  class pointer {
+   public:
+    explicit pointer(reference ref) : ref_(ref) {}
+    const reference *operator->() const noexcept { return &ref_; }
+
+   private:
+    reference ref_;
+  };
+
+  template <typename K, typename V, typename C, typename A>
+  friend class FlatMap;
+  friend class FlatMapIterator<Key, T, !IsConst>;
+
+  FlatMapIterator() noexcept : key_(nullptr), value_(nullptr) {}
+
+  // iterator converts to const_iterator
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  FlatMapIterator(const FlatMapIterator<Key, T, false> &other) noexcept
+      : key_(other.key_), value_(other.value_) {}
+
+  reference operator*() const { return reference(*key_, *value_); }
+  pointer operator->() const { return pointer(**this); }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  FlatMapIterator &operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+
+  FlatMapIterator operator++(int) {
+    FlatMapIterator copy(*this);
+    ++*this;
+    return copy;
+  }
+
+  FlatMapIterator &operator--() {
+    --key_;
+    --value_;
+    return *this;
+  }
+
+  FlatMapIterator operator--(int) {
+    FlatMapIterator copy(*this);
+    --*this;
+    return copy;
+  }
+
+  FlatMapIterator &operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+
+  FlatMapIterator &operator-=(difference_type n) { return *this += -n; }
+
+  FlatMapIterator operator+(difference_type n) const {
+    FlatMapIterator copy(*this);
+    return copy += n;
+  }
+
+  FlatMapIterator operator-(difference_type n) const {
+    FlatMapIterator copy(*this);
+    return copy -= n;
+  }
+
+  difference_type operator-(const FlatMapIterator &other) const {
+    return key_ - other.key_;
+  }
+
+  bool operator==(const FlatMapIterator &other) const {
+    return key_ == other.key_;
+  }
+  bool operator!=(const FlatMapIterator &other) const {
+    return key_ != other.key_;
+  }
+  bool operator<(const FlatMapIterator &other) const {
+    return key_ < other.key_;
+  }
+  bool operator>(const FlatMapIterator &other) const {
+    return key_ > other.key_;
+  }
+  bool operator<=(const FlatMapIterator &other) const {
+    return key_ <= other.key_;
+  }
+  bool operator>=(const FlatMapIterator &other) const {
+    return key_ >= other.key_;
+  }
+
+ private:
+  FlatMapIterator(const Key *key, mapped_pointer value) noexcept
+      : key_(key), value_(value) {}
+
+  const Key *key_;
+  mapped_pointer value_;
+};
+
+}  // namespace s21
+
+#endif  // _FLAT_MAP_H_
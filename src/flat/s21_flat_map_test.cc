@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+// copies and moves throw once the shared countdown reaches zero; a move
+// that gets through empties its source
+struct CountdownCopy {
+  static inline int copies_left = -1;
+
+  explicit CountdownCopy(int v) : value(v) {}
+  CountdownCopy(const CountdownCopy &other) : value(other.value) { CountDown(); }
+  CountdownCopy(CountdownCopy &&other) : value(other.value) {
+    CountDown();
+    other.value = -1;
+  }
+  CountdownCopy &operator=(const CountdownCopy &) = default;
+  CountdownCopy &operator=(CountdownCopy &&) = default;
+
+  static void CountDown() {
+    if (--copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(TestFlatMap, BulkBuildSortsAndKeepsFirstDuplicate) {
+  s21::FlatMap<int, std::string> m{{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.at(1), "a");
+  int expected = 1;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_EQ((*it).first, expected);
+    ++expected;
+  }
+  ASSERT_EQ(m.keys().at(0), 1);
+  ASSERT_EQ(m.values().at(2), "c");
+}
+
+TEST(TestFlatMap, RangeConstructorMatchesStdMap) {
+  std::vector<std::pair<int, int>> items;
+  std::mt19937 rng(21);
+  for (int i = 0; i < 5000; ++i) {
+    items.push_back({static_cast<int>(rng() % 3000), i});
+  }
+  s21::FlatMap<int, int> m(items.begin(), items.end());
+  std::map<int, int> expected;
+  for (const auto &item : items) {
+    expected.insert(item);
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.cbegin();
+  for (const auto &kv : expected) {
+    ASSERT_EQ(it->first, kv.first);
+    ASSERT_EQ(it->second, kv.second);
+    ++it;
+  }
+  ASSERT_TRUE(it == m.cend());
+  for (int key = -1; key <= 3001; ++key) {
+    ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+    auto lower = m.lower_bound(key);
+    auto upper = m.upper_bound(key);
+    auto std_lower = expected.lower_bound(key);
+    auto std_upper = expected.upper_bound(key);
+    ASSERT_EQ(lower == m.end(), std_lower == expected.end());
+    ASSERT_EQ(upper == m.end(), std_upper == expected.end());
+    if (lower != m.end()) {
+      ASSERT_EQ(lower->first, std_lower->first);
+    }
+    if (upper != m.end()) {
+      ASSERT_EQ(upper->first, std_upper->first);
+    }
+  }
+}
+
+TEST(TestFlatMap, InsertEraseKeepOrder) {
+  s21::FlatMap<int, int> m;
+  ASSERT_TRUE(m.find(1) == m.end());
+  ASSERT_TRUE(m.insert(5, 50).second);
+  ASSERT_TRUE(m.insert({1, 10}).second);
+  ASSERT_TRUE(m.insert(std::make_pair(3, 30)).second);
+  ASSERT_FALSE(m.insert(3, 31).second);
+  ASSERT_TRUE(m.emplace(4, 40).second);
+  auto result = m.insert_or_assign(3, 33);
+  ASSERT_FALSE(result.second);
+  ASSERT_EQ(result.first->second, 33);
+  m[2] = 20;
+  ++m[2];
+  ASSERT_EQ(m.size(), 5u);
+  std::vector<int> keys;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    keys.push_back(it->first);
+  }
+  ASSERT_EQ(keys, (std::vector<int>{1, 2, 3, 4, 5}));
+  ASSERT_EQ(m.at(2), 21);
+  ASSERT_EQ(m.erase(3), 1u);
+  ASSERT_EQ(m.erase(3), 0u);
+  m.erase(m.find(1));
+  m.erase(m.end());
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(m.begin()->first, 2);
+  ASSERT_THROW(m.at(1), std::out_of_range);
+  auto range = m.equal_range(4);
+  ASSERT_EQ(range.second - range.first, 1);
+}
+
+TEST(TestFlatMap, MutableThroughIterator) {
+  s21::FlatMap<std::string, int> m{{"a", 1}, {"b", 2}};
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    (*it).second *= 10;
+  }
+  m.find("b")->second += 1;
+  const auto &cm = m;
+  ASSERT_EQ(cm.at("a"), 10);
+  ASSERT_EQ(cm.find("b")->second, 21);
+  ASSERT_TRUE(cm.find("c") == cm.end());
+}
+
+TEST(TestFlatMap, CopySwapMerge) {
+  s21::FlatMap<int, int> a{{1, 1}, {3, 3}};
+  s21::FlatMap<int, int> b(a);
+  b[2] = 2;
+  ASSERT_EQ(a.size(), 2u);
+  s21::FlatMap<int, int> c{{3, 30}, {4, 40}, {0, 0}};
+  b.merge(c);
+  ASSERT_EQ(b.size(), 5u);
+  ASSERT_EQ(b.at(3), 3);
+  ASSERT_EQ(b.begin()->first, 0);
+  ASSERT_EQ(c.size(), 1u);
+  ASSERT_EQ(c.at(3), 30);
+  a.swap(c);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(c.size(), 2u);
+  s21::FlatMap<int, int> moved(std::move(b));
+  ASSERT_EQ(moved.size(), 5u);
+}
+
+TEST(TestFlatMap, TransparentLookup) {
+  s21::FlatMap<std::string, int, std::less<>> m{{"alpha", 1}, {"beta", 2}};
+  ASSERT_TRUE(m.contains(std::string_view("beta")));
+  ASSERT_EQ(m.find("alpha")->second, 1);
+}
+
+TEST(TestFlatMap, MergeMatchesStdMap) {
+  std::mt19937 rng(17);
+  s21::FlatMap<int, int> a;
+  s21::FlatMap<int, int> b;
+  std::map<int, int> expected_a;
+  std::map<int, int> expected_b;
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(rng() % 4000);
+    a.insert(key, i);
+    expected_a.insert({key, i});
+    key = static_cast<int>(rng() % 4000);
+    b.insert(key, -i);
+    expected_b.insert({key, -i});
+  }
+  a.merge(b);
+  expected_a.merge(expected_b);
+  ASSERT_TRUE(std::equal(a.begin(), a.end(), expected_a.begin(),
+                         expected_a.end(), [](auto lhs, const auto &rhs) {
+                           return lhs.first == rhs.first &&
+                                  lhs.second == rhs.second;
+                         }));
+  ASSERT_TRUE(std::equal(b.begin(), b.end(), expected_b.begin(),
+                         expected_b.end(), [](auto lhs, const auto &rhs) {
+                           return lhs.first == rhs.first &&
+                                  lhs.second == rhs.second;
+                         }));
+}
+
+TEST(TestFlatMap, FailedMergeKeepsBothMaps) {
+  s21::FlatMap<int, CountdownCopy> a;
+  s21::FlatMap<int, CountdownCopy> b;
+  for (int i = 0; i < 100; ++i) {
+    a.emplace(2 * i, CountdownCopy(i));
+    b.emplace(3 * i, CountdownCopy(-i));
+  }
+  CountdownCopy::copies_left = 120;
+  ASSERT_THROW(a.merge(b), std::runtime_error);
+  CountdownCopy::copies_left = -1;
+  ASSERT_EQ(a.size(), 100u);
+  ASSERT_EQ(b.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(a.at(2 * i).value, i);
+    ASSERT_EQ(b.at(3 * i).value, -i);
+  }
+  a.merge(b);
+  ASSERT_EQ(a.size(), 166u);
+  ASSERT_EQ(b.size(), 34u);
+  ASSERT_EQ(a.at(3).value, -1);
+  ASSERT_EQ(b.at(6).value, -2);
+}
@@ -0,0 +1,216 @@
+#ifndef _FLAT_SET_H_
+#define _FLAT_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "flat_search.h"
+
+namespace s21 {
+
+// Sorted set kept in one s21::Vector; see FlatMap for the trade-offs.
+// Elements are immutable, so iterator and const_iterator are both plain
+// pointers to const.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<Key>>
+class FlatSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = Key &;
+  using const_reference = const Key &;
+  using allocator_type = Alloc;
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+  using size_type = size_t;
+  using container_type = Vector<Key, Alloc>;
+
+  FlatSet() : keys_(), compare_() {}
+
+  FlatSet(std::initializer_list<value_type> const &items) : FlatSet() {
+    Build(items.begin(), items.end());
+  }
+
+  // sorts [first, last) once and drops duplicates
+  template <typename InputIt>
+  FlatSet(InputIt first, InputIt last) : FlatSet() {
+    Build(first, last);
+  }
+
+  FlatSet(const FlatSet &other) = default;
+  FlatSet(FlatSet &&other) = default;
+  FlatSet &operator=(const FlatSet &other) = default;
+  FlatSet &operator=(FlatSet &&other) = default;
+  ~FlatSet() = default;
+
+  iterator begin() const noexcept { return keys_.data(); }
+  iterator end() const noexcept { return keys_.data() + size(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+
+  size_type size() const noexcept { return keys_.size(); }
+
+  size_type max_size() const noexcept { return keys_.max_size(); }
+
+  void reserve(size_type count) { keys_.reserve(count); }
+
+  void clear() noexcept { keys_.clear(); }
+
+  // the sorted elements
+  const container_type &keys() const noexcept { return keys_; }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return Insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return Insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return Insert(value_type(std::forward<Args>(args)...));
+  }
+
+  void erase(const_iterator pos) {
+    if (pos < begin() || pos >= end()) {
+      return;
+    }
+    EraseAt(static_cast<size_type>(pos - begin()));
+  }
+
+  size_type erase(const key_type &key) {
+    size_type index = FindIndex(key);
+    if (index == size()) {
+      return 0;
+    }
+    EraseAt(index);
+    return 1;
+  }
+
+  void swap(FlatSet &other) {
+    keys_.swap(other.keys_);
+    std::swap(compare_, other.compare_);
+  }
+
+  // Moves in the elements of other that are not here yet, in one pass over
+  // both sorted runs; as in FlatMap::merge, an exception changes neither set.
+  void merge(FlatSet &other) {
+    if (this == &other) {
+      return;
+    }
+    container_type keys;
+    container_type rest;
+    keys.reserve(size() + other.size());
+    rest.reserve(other.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() || j < other.size()) {
+      if (j == other.size() ||
+          (i < size() && compare_(keys_[i], other.keys_[j]))) {
+        keys.push_back(std::move_if_noexcept(keys_[i]));
+        ++i;
+        continue;
+      }
+      if (i == size() || compare_(other.keys_[j], keys_[i])) {
+        keys.push_back(std::move_if_noexcept(other.keys_[j]));
+      } else {
+        rest.push_back(std::move_if_noexcept(other.keys_[j]));
+      }
+      ++j;
+    }
+    keys_.swap(keys);
+    other.keys_.swap(rest);
+  }
+
+  bool contains(const Key &key) const { return FindIndex(key) != size(); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return FindIndex(key) != size();
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  iterator find(const key_type &key) const { return begin() + FindIndex(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const {
+    return begin() + FindIndex(key);
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return begin() + FlatLowerBound(keys_.data(), size(), key, compare_);
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return begin() + FlatUpperBound(keys_.data(), size(), key, compare_);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ private:
+  template <typename K>
+  size_type FindIndex(const K &key) const {
+    size_type index = FlatLowerBound(keys_.data(), size(), key, compare_);
+    if (index != size() && compare_(key, keys_.data()[index])) {
+      index = size();
+    }
+    return index;
+  }
+
+  template <typename V>
+  std::pair<iterator, bool> Insert(V &&value) {
+    size_type index = FlatLowerBound(keys_.data(), size(), value, compare_);
+    if (index != size() && !compare_(value, keys_.data()[index])) {
+      return {begin() + index, false};
+    }
+    // value may be an element of keys_, which the insertion shifts
+    value_type copy(std::forward<V>(value));
+    keys_.insert(typename container_type::iterator(keys_.data() + index),
+                 std::move(copy));
+    return {begin() + index, true};
+  }
+
+  void EraseAt(size_type index) {
+    keys_.erase(typename container_type::iterator(keys_.data() + index));
+  }
+
+  template <typename InputIt>
+  void Build(InputIt first, InputIt last) {
+    container_type items;
+    for (; first != last; ++first) {
+      items.push_back(*first);
+    }
+    BuildSorted(items);
+  }
+
+  void BuildSorted(container_type &items) {
+    Key *data = items.data();
+    Key *last = data + items.size();
+    std::stable_sort(data, last, compare_);
+    last = std::unique(data, last, [this](const Key &a, const Key &b) {
+      return !compare_(a, b);
+    });
+    reserve(static_cast<size_type>(last - data));
+    for (; data != last; ++data) {
+      keys_.push_back(std::move(*data));
+    }
+  }
+
+  container_type keys_;
+  Compare compare_;
+};
+
+}  // namespace s21
+
+#endif  // _FLAT_SET_H_
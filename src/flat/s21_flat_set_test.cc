@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+// copies and moves throw once the shared countdown reaches zero; a move
+// that gets through empties its source
+struct CountdownKey {
+  static inline int copies_left = -1;
+
+  explicit CountdownKey(int v) : value(v) {}
+  CountdownKey(const CountdownKey &other) : value(other.value) { CountDown(); }
+  CountdownKey(CountdownKey &&other) : value(other.value) {
+    CountDown();
+    other.value = -1;
+  }
+  CountdownKey &operator=(const CountdownKey &) = default;
+  CountdownKey &operator=(CountdownKey &&) = default;
+
+  static void CountDown() {
+    if (--copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+
+  bool operator<(const CountdownKey &other) const {
+    return value < other.value;
+  }
+
+  int value;
+};
+
+std::vector<int> Values(const s21::FlatSet<CountdownKey> &s) {
+  std::vector<int> values;
+  for (const CountdownKey &key : s) {
+    values.push_back(key.value);
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(TestFlatSet, BulkBuildSortsAndDedups) {
+  std::vector<int> items{5, 3, 5, 1, 3, 9};
+  s21::FlatSet<int> s(items.begin(), items.end());
+  ASSERT_EQ(s.size(), 4u);
+  ASSERT_EQ(std::vector<int>(s.begin(), s.end()),
+            (std::vector<int>{1, 3, 5, 9}));
+}
+
+TEST(TestFlatSet, InsertEraseFind) {
+  s21::FlatSet<std::string> s{"b", "d"};
+  ASSERT_TRUE(s.insert("c").second);
+  ASSERT_FALSE(s.insert(std::string("b")).second);
+  ASSERT_TRUE(s.emplace(1, 'a').second);
+  ASSERT_EQ(*s.begin(), "a");
+  ASSERT_EQ(*s.find("c"), "c");
+  ASSERT_TRUE(s.find("e") == s.end());
+  ASSERT_EQ(*s.lower_bound("bb"), "c");
+  ASSERT_EQ(*s.upper_bound("c"), "d");
+  ASSERT_EQ(s.erase("b"), 1u);
+  s.erase(s.find("a"));
+  ASSERT_EQ(std::vector<std::string>(s.begin(), s.end()),
+            (std::vector<std::string>{"c", "d"}));
+}
+
+TEST(TestFlatSet, MatchesStdSetBounds) {
+  std::set<int> expected;
+  s21::FlatSet<int> s;
+  for (int i = 0; i < 300; ++i) {
+    int key = (i * 37) % 211;
+    ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+  }
+  for (int key = -2; key < 215; ++key) {
+    auto lower = s.lower_bound(key);
+    auto std_lower = expected.lower_bound(key);
+    ASSERT_EQ(lower == s.end(), std_lower == expected.end());
+    if (lower != s.end()) {
+      ASSERT_EQ(*lower, *std_lower);
+    }
+    ASSERT_EQ(s.count(key), expected.count(key));
+  }
+}
+
+TEST(TestFlatSet, Merge) {
+  s21::FlatSet<int> a{1, 3};
+  s21::FlatSet<int> b{3, 2};
+  a.merge(b);
+  ASSERT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(std::vector<int>(b.begin(), b.end()), (std::vector<int>{3}));
+}
+
+TEST(TestFlatSet, FailedMergeKeepsBothSets) {
+  s21::FlatSet<CountdownKey> a;
+  s21::FlatSet<CountdownKey> b;
+  for (int i = 0; i < 50; ++i) {
+    a.insert(CountdownKey(2 * i));
+    b.insert(CountdownKey(3 * i));
+  }
+  const std::vector<int> a_before = Values(a);
+  const std::vector<int> b_before = Values(b);
+  CountdownKey::copies_left = 60;
+  ASSERT_THROW(a.merge(b), std::runtime_error);
+  CountdownKey::copies_left = -1;
+  ASSERT_EQ(Values(a), a_before);
+  ASSERT_EQ(Values(b), b_before);
+  a.merge(b);
+  std::set<int> expected(a_before.begin(), a_before.end());
+  expected.insert(b_before.begin(), b_before.end());
+  ASSERT_EQ(Values(a), std::vector<int>(expected.begin(), expected.end()));
+  ASSERT_EQ(b.size(), 17u);
+}
@@ -0,0 +1,307 @@
+#ifndef S21_INTRUSIVE_LIST_H_
+#define S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+// Links an object into one IntrusiveList. The object derives from the hook;
+// an object that has to sit in several lists at once derives from one hook
+// per list, told apart by Tag. A copied hook starts unlinked, so copying an
+// object never copies its place in a list.
+template <typename Tag = void>
+class IntrusiveListHook {
+ public:
+  IntrusiveListHook() noexcept : prev_(nullptr), next_(nullptr) {}
+  IntrusiveListHook(const IntrusiveListHook &) noexcept
+      : prev_(nullptr), next_(nullptr) {}
+  IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept {
+    return *this;
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  template <typename, typename>
+  friend class IntrusiveList;
+  template <typename, typename, bool>
+  friend class IntrusiveListIterator;
+
+  IntrusiveListHook *prev_;
+  IntrusiveListHook *next_;
+};
+
+template <typename T, typename Tag, bool IsConst>
+class IntrusiveListIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+  using hook_type = IntrusiveListHook<Tag>;
+  using hook_pointer =
+      std::conditional_t<IsConst, const hook_type *, hook_type *>;
+
+  IntrusiveListIterator() noexcept : hook_(nullptr) {}
+  explicit IntrusiveListIterator(hook_pointer hook) noexcept : hook_(hook) {}
+  // iterator converts to const_iterator
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  IntrusiveListIterator(
+      const IntrusiveListIterator<T, Tag, false> &other) noexcept
+      : hook_(other.hook()) {}
+
+  reference operator*() const { return static_cast<reference>(*hook_); }
+  pointer operator->() const { return static_cast<pointer>(hook_); }
+
+  IntrusiveListIterator &operator++() noexcept {
+    hook_ = hook_->next_;
+    return *this;
+  }
+
+  IntrusiveListIterator operator++(int) noexcept {
+    IntrusiveListIterator tmp(*this);
+    hook_ = hook_->next_;
+    return tmp;
+  }
+
+  IntrusiveListIterator &operator--() noexcept {
+    hook_ = hook_->prev_;
+    return *this;
+  }
+
+  IntrusiveListIterator operator--(int) noexcept {
+    IntrusiveListIterator tmp(*this);
+    hook_ = hook_->prev_;
+    return tmp;
+  }
+
+  bool operator==(const IntrusiveListIterator &other) const noexcept {
+    return hook_ == other.hook_;
+  }
+
+  bool operator!=(const IntrusiveListIterator &other) const noexcept {
+    return hook_ != other.hook_;
+  }
+
+  hook_pointer hook() const noexcept { return hook_; }
+
+ private:
+  hook_pointer hook_;
+};
+
+// Doubly linked list of objects that live elsewhere, e.g. in an arena: the
+// links are the object's own IntrusiveListHook, so the list never allocates
+// and never copies T. The list does not own its elements; they must outlive
+// their membership, and clear() or the destructor only unlinks them.
+//
+// Unlike s21::list, end() is past the last element, as in std::list: the
+// list holds a sentinel hook that closes the chain into a ring. Removing an
+// object given by reference, erase(T &), is O(1).
+template <typename T, typename Tag = void>
+class IntrusiveList {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using hook_type = IntrusiveListHook<Tag>;
+  using iterator = IntrusiveListIterator<T, Tag, false>;
+  using const_iterator = IntrusiveListIterator<T, Tag, true>;
+
+  static_assert(std::is_base_of_v<hook_type, T>,
+                "T must derive from IntrusiveListHook<Tag>");
+
+  IntrusiveList() noexcept : size_(0) { Reset(); }
+
+  IntrusiveList(const IntrusiveList &) = delete;
+  IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+  IntrusiveList(IntrusiveList &&other) noexcept : size_(0) {
+    Reset();
+    TakeFrom(other);
+  }
+
+  IntrusiveList &operator=(IntrusiveList &&other) noexcept {
+    if (this != &other) {
+      clear();
+      TakeFrom(other);
+    }
+    return *this;
+  }
+
+  ~IntrusiveList() { clear(); }
+
+  iterator begin() noexcept { return iterator(sentinel_.next_); }
+  iterator end() noexcept { return iterator(&sentinel_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next_);
+  }
+  const_iterator end() const noexcept { return const_iterator(&sentinel_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  reference front() {
+    if (empty()) {
+      throw std::out_of_range("Empty list");
+    }
+    return *begin();
+  }
+
+  reference back() {
+    if (empty()) {
+      throw std::out_of_range("Empty list");
+    }
+    return *iterator(sentinel_.prev_);
+  }
+
+  void push_back(T &value) { insert(cend(), value); }
+  void push_front(T &value) { insert(cbegin(), value); }
+
+  void pop_front() {
+    if (!empty()) {
+      Unlink(sentinel_.next_);
+    }
+  }
+
+  void pop_back() {
+    if (!empty()) {
+      Unlink(sentinel_.prev_);
+    }
+  }
+
+  // Links value before pos. An object already in a list, this one or
+  // another, throws std::invalid_argument.
+  iterator insert(const_iterator pos, T &value) {
+    hook_type *hook = &value;
+    if (hook->is_linked()) {
+      throw std::invalid_argument("object is already in a list");
+    }
+    LinkBefore(hook, Mutable(pos));
+    ++size_;
+    return iterator(hook);
+  }
+
+  // Unlinks the element at pos and returns the one after it.
+  iterator erase(const_iterator pos) noexcept {
+    hook_type *next = Mutable(pos)->next_;
+    Unlink(Mutable(pos));
+    return iterator(next);
+  }
+
+  // Unlinks value, which must be in this list, without searching for it.
+  void erase(T &value) noexcept { Unlink(&value); }
+
+  iterator iterator_to(T &value) noexcept { return iterator(&value); }
+  const_iterator iterator_to(const T &value) const noexcept {
+    return const_iterator(&value);
+  }
+
+  void clear() noexcept {
+    hook_type *hook = sentinel_.next_;
+    while (hook != &sentinel_) {
+      hook_type *next = hook->next_;
+      hook->prev_ = nullptr;
+      hook->next_ = nullptr;
+      hook = next;
+    }
+    Reset();
+    size_ = 0;
+  }
+
+  void swap(IntrusiveList &other) noexcept {
+    IntrusiveList tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  // Moves every element of other before pos in O(1).
+  void splice(const_iterator pos, IntrusiveList &other) noexcept {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    hook_type *first = other.sentinel_.next_;
+    hook_type *last = other.sentinel_.prev_;
+    hook_type *next = Mutable(pos);
+    first->prev_ = next->prev_;
+    next->prev_->next_ = first;
+    last->next_ = next;
+    next->prev_ = last;
+    size_ += other.size_;
+    other.Reset();
+    other.size_ = 0;
+  }
+
+  // Moves the element at it, which is in other, before pos.
+  void splice(const_iterator pos, IntrusiveList &other,
+              const_iterator it) noexcept {
+    hook_type *hook = Mutable(it);
+    if (hook == Mutable(pos) || hook->next_ == Mutable(pos)) {
+      return;
+    }
+    other.Unlink(hook);
+    LinkBefore(hook, Mutable(pos));
+    ++size_;
+  }
+
+  void reverse() noexcept {
+    hook_type *hook = &sentinel_;
+    do {
+      std::swap(hook->prev_, hook->next_);
+      hook = hook->prev_;
+    } while (hook != &sentinel_);
+  }
+
+ private:
+  hook_type sentinel_;
+  size_type size_;
+
+  // the iterators of a non-const list point at its own, mutable hooks
+  static hook_type *Mutable(const_iterator pos) noexcept {
+    return const_cast<hook_type *>(pos.hook());
+  }
+
+  void Reset() noexcept {
+    sentinel_.prev_ = &sentinel_;
+    sentinel_.next_ = &sentinel_;
+  }
+
+  static void LinkBefore(hook_type *hook, hook_type *next) noexcept {
+    hook->prev_ = next->prev_;
+    hook->next_ = next;
+    next->prev_->next_ = hook;
+    next->prev_ = hook;
+  }
+
+  void Unlink(hook_type *hook) noexcept {
+    hook->prev_->next_ = hook->next_;
+    hook->next_->prev_ = hook->prev_;
+    hook->prev_ = nullptr;
+    hook->next_ = nullptr;
+    --size_;
+  }
+
+  // takes over other's chain; *this is empty on entry
+  void TakeFrom(IntrusiveList &other) noexcept {
+    if (other.empty()) {
+      return;
+    }
+    sentinel_.next_ = other.sentinel_.next_;
+    sentinel_.prev_ = other.sentinel_.prev_;
+    sentinel_.next_->prev_ = &sentinel_;
+    sentinel_.prev_->next_ = &sentinel_;
+    size_ = other.size_;
+    other.Reset();
+    other.size_ = 0;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H_
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+struct ByAge {};
+
+struct Connection : s21::IntrusiveListHook<>, s21::IntrusiveListHook<ByAge> {
+  explicit Connection(int id) : id(id) {}
+  int id;
+};
+
+using ConnectionList = s21::IntrusiveList<Connection>;
+using AgeList = s21::IntrusiveList<Connection, ByAge>;
+
+template <typename List>
+std::vector<int> Ids(const List &list) {
+  std::vector<int> ids;
+  for (const Connection &connection : list) {
+    ids.push_back(connection.id);
+  }
+  std::vector<int> backwards;
+  for (auto it = list.end(); it != list.begin();) {
+    --it;
+    backwards.push_back(it->id);
+  }
+  std::reverse(backwards.begin(), backwards.end());
+  EXPECT_EQ(ids, backwards);
+  EXPECT_EQ(ids.size(), list.size());
+  return ids;
+}
+
+std::vector<Connection> Arena(int n) {
+  std::vector<Connection> arena;
+  for (int i = 0; i < n; ++i) {
+    arena.emplace_back(i);
+  }
+  return arena;
+}
+
+}  // namespace
+
+TEST(IntrusiveList, PushPopAndAccess) {
+  auto arena = Arena(4);
+  ConnectionList list;
+  ASSERT_TRUE(list.empty());
+  ASSERT_TRUE(list.begin() == list.end());
+  ASSERT_THROW(list.front(), std::out_of_range);
+  list.push_back(arena[1]);
+  list.push_back(arena[2]);
+  list.push_front(arena[0]);
+  list.insert(list.end(), arena[3]);
+  ASSERT_EQ(Ids(list), (std::vector<int>{0, 1, 2, 3}));
+  ASSERT_EQ(list.front().id, 0);
+  ASSERT_EQ(list.back().id, 3);
+  list.pop_front();
+  list.pop_back();
+  ASSERT_EQ(Ids(list), (std::vector<int>{1, 2}));
+  ASSERT_FALSE(arena[0].s21::IntrusiveListHook<>::is_linked());
+  ASSERT_TRUE(arena[1].s21::IntrusiveListHook<>::is_linked());
+  list.front().id = 10;
+  ASSERT_EQ(arena[1].id, 10);
+}
+
+TEST(IntrusiveList, EraseByObjectAndIterator) {
+  auto arena = Arena(5);
+  ConnectionList list;
+  for (auto &connection : arena) {
+    list.push_back(connection);
+  }
+  list.erase(arena[2]);
+  ASSERT_EQ(Ids(list), (std::vector<int>{0, 1, 3, 4}));
+  auto next = list.erase(list.iterator_to(arena[3]));
+  ASSERT_EQ(next->id, 4);
+  ASSERT_TRUE(list.erase(next) == list.end());
+  ASSERT_EQ(Ids(list), (std::vector<int>{0, 1}));
+  list.push_back(arena[2]);
+  ASSERT_EQ(Ids(list), (std::vector<int>{0, 1, 2}));
+}
+
+TEST(IntrusiveList, LinkedObjectCannotBeInsertedTwice) {
+  auto arena = Arena(1);
+  ConnectionList first;
+  ConnectionList second;
+  first.push_back(arena[0]);
+  ASSERT_THROW(second.push_back(arena[0]), std::invalid_argument);
+  ASSERT_THROW(first.push_front(arena[0]), std::invalid_argument);
+  ASSERT_EQ(first.size(), 1u);
+  ASSERT_TRUE(second.empty());
+}
+
+TEST(IntrusiveList, OneObjectInTwoLists) {
+  auto arena = Arena(3);
+  ConnectionList by_id;
+  AgeList by_age;
+  for (auto &connection : arena) {
+    by_id.push_back(connection);
+    by_age.push_front(connection);
+  }
+  ASSERT_EQ(Ids(by_id), (std::vector<int>{0, 1, 2}));
+  ASSERT_EQ(Ids(by_age), (std::vector<int>{2, 1, 0}));
+  by_age.erase(arena[1]);
+  ASSERT_EQ(Ids(by_id), (std::vector<int>{0, 1, 2}));
+  ASSERT_EQ(Ids(by_age), (std::vector<int>{2, 0}));
+}
+
+TEST(IntrusiveList, Splice) {
+  auto arena = Arena(6);
+  ConnectionList a;
+  ConnectionList b;
+  for (int i = 0; i < 3; ++i) {
+    a.push_back(arena[i]);
+    b.push_back(arena[i + 3]);
+  }
+  a.splice(++a.cbegin(), b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(Ids(a), (std::vector<int>{0, 3, 4, 5, 1, 2}));
+  b.splice(b.cend(), a, a.iterator_to(arena[4]));
+  ASSERT_EQ(Ids(a), (std::vector<int>{0, 3, 5, 1, 2}));
+  ASSERT_EQ(Ids(b), (std::vector<int>{4}));
+  a.splice(a.cbegin(), a, a.iterator_to(arena[2]));
+  ASSERT_EQ(Ids(a), (std::vector<int>{2, 0, 3, 5, 1}));
+  a.splice(a.iterator_to(arena[0]), a, a.iterator_to(arena[2]));
+  ASSERT_EQ(Ids(a), (std::vector<int>{2, 0, 3, 5, 1}));
+  a.splice(a.cend(), b);
+  ASSERT_EQ(Ids(a), (std::vector<int>{2, 0, 3, 5, 1, 4}));
+  a.reverse();
+  ASSERT_EQ(Ids(a), (std::vector<int>{4, 1, 5, 3, 0, 2}));
+}
+
+TEST(IntrusiveList, MoveSwapAndClear) {
+  auto arena = Arena(4);
+  ConnectionList a;
+  a.push_back(arena[0]);
+  a.push_back(arena[1]);
+  ConnectionList moved(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(Ids(moved), (std::vector<int>{0, 1}));
+  ConnectionList b;
+  b.push_back(arena[2]);
+  b.swap(moved);
+  ASSERT_EQ(Ids(b), (std::vector<int>{0, 1}));
+  ASSERT_EQ(Ids(moved), (std::vector<int>{2}));
+  moved = std::move(b);
+  ASSERT_FALSE(arena[2].s21::IntrusiveListHook<>::is_linked());
+  ASSERT_EQ(Ids(moved), (std::vector<int>{0, 1}));
+  Connection copy(arena[0]);
+  ASSERT_FALSE(copy.s21::IntrusiveListHook<>::is_linked());
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  for (auto &connection : arena) {
+    ASSERT_FALSE(connection.s21::IntrusiveListHook<>::is_linked());
+  }
+  {
+    ConnectionList scoped;
+    scoped.push_back(arena[3]);
+  }
+  ASSERT_FALSE(arena[3].s21::IntrusiveListHook<>::is_linked());
+}
+
+TEST(IntrusiveList, RandomOperationsMatchStdList) {
+  auto arena = Arena(64);
+  ConnectionList list;
+  std::list<int> expected;
+  std::mt19937 rng(24);
+  for (int step = 0; step < 20000; ++step) {
+    Connection &connection = arena[rng() % arena.size()];
+    bool linked = connection.s21::IntrusiveListHook<>::is_linked();
+    if (linked) {
+      list.erase(connection);
+      expected.remove(connection.id);
+    } else if (rng() % 2 == 0) {
+      list.push_back(connection);
+      expected.push_back(connection.id);
+    } else {
+      list.push_front(connection);
+      expected.push_front(connection.id);
+    }
+  }
+  ASSERT_EQ(Ids(list), std::vector<int>(expected.begin(), expected.end()));
+}
@@ -13,10 +13,20 @@
 #ifndef S21_LIST_H_
 #define S21_LIST_H_
 
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../allocator/s21_pool_allocator.h"
 
 namespace s21 {
-template <typename T>
+// Узлы берутся из Alloc, перепривязанного к Node_; с PoolAllocator узлы,
+// освобожденные pop_front/pop_back/erase, переиспользуются за O(1), а память
+// возвращается целиком после clear().
+template <typename T, typename Alloc = std::allocator<T>>
 class list {
  public:
   class ListIterator;
@@ -25,16 +35,22 @@ class list {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
-  using iterator = list<T>::ListIterator;
-  using const_iterator = list<T>::ListConstIterator;
+  using allocator_type = Alloc;
+  using iterator = ListIterator;
+  using const_iterator = ListConstIterator;
 
   typedef struct Node_ {
     T data;
     Node_ *prev;
     Node_ *next;
-    explicit Node_(const T &data) : data(data), prev(nullptr), next(nullptr) {}
+    template <typename... Args>
+    explicit Node_(std::in_place_t, Args &&...args)
+        : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
   } Node_;
 
+  using NodeAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node_>;
+
   class ListIterator {
    public:
     ListIterator() : iter_(nullptr) {}
@@ -71,7 +87,7 @@ class list {
 
     reference operator*() { return iter_->data; }
 
-    T *operator->() { return &(iter_->value); }
+    T *operator->() { return &(iter_->data); }
 
     Node_ *get_node() { return iter_; };
 
@@ -126,23 +142,31 @@ class list {
 
   // ---------- start constructors ---------
 
-  list() noexcept : head_(nullptr), tail_(nullptr), size_(0){};
+  list() noexcept(std::is_nothrow_default_constructible_v<NodeAlloc>)
+      : alloc_node_(), head_(nullptr), tail_(nullptr), size_(0){};
+
+  explicit list(const allocator_type &alloc) noexcept
+      : alloc_node_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
 
-  explicit list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+  explicit list(size_type n)
+      : alloc_node_(), head_(nullptr), tail_(nullptr), size_(0) {
     for (size_type i = 0; i < n; i++) {
       push_back(value_type());
     }
   };
 
   list(std::initializer_list<value_type> const &items)
-      : head_(nullptr), tail_(nullptr), size_(0) {
+      : alloc_node_(), head_(nullptr), tail_(nullptr), size_(0) {
     for (auto const &items : items) {
       push_back(items);
     }
   };
 
   list(const list &l)
-      : head_(nullptr), tail_(nullptr), size_(0) {  // copy constructor
+      : alloc_node_(),
+        head_(nullptr),
+        tail_(nullptr),
+        size_(0) {  // copy constructor
     Node_ *current = l.head_;
     while (current != nullptr) {
       push_back(current->data);
@@ -151,7 +175,10 @@ class list {
   };
 
   list(list &&l)
-      : head_(l.head_), tail_(l.tail_), size_(l.size_) {  // move constructor
+      : alloc_node_(std::move(l.alloc_node_)),
+        head_(l.head_),
+        tail_(l.tail_),
+        size_(l.size_) {  // move constructor
     l.head_ = nullptr;
     l.tail_ = nullptr;
     l.size_ = 0;
@@ -161,11 +188,9 @@ class list {
     if (this == &l) {
       return *this;
     }
-    Node_ *current = this->head_;
-    while (head_ != nullptr) {
-      current = head_->next;
-      delete current;
-    }
+    clear();
+    // узлы l уходят вместе с аллокатором, которому они принадлежат
+    std::swap(alloc_node_, l.alloc_node_);
     head_ = l.head_;
     tail_ = l.tail_;
     size_ = l.size_;
@@ -177,9 +202,7 @@ class list {
     return *this;
   };
 
-  ~list() {
-    while (head_ != nullptr) pop_front();
-  }
+  ~list() { clear(); }
 
   // ---------- end constructors ---------
 
@@ -209,11 +232,25 @@ class list {
   size_type size() { return size_; };
 
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max();
+    return std::allocator_traits<NodeAlloc>::max_size(alloc_node_);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_node_);
   }
 
-  void push_back(const_reference value) {
-    Node_ *new_node = new Node_(value);
+  void push_back(const_reference value) { emplace_back(value); };
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  void push_front(const_reference value) { emplace_front(value); };
+
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  // конструирует элемент на месте в конце списка
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    Node_ *new_node = AllocateNode(std::forward<Args>(args)...);
     if (head_ == nullptr) {
       head_ = tail_ = new_node;
     } else {
@@ -222,10 +259,13 @@ class list {
       tail_ = new_node;
     }
     size_++;
-  };
+    return new_node->data;
+  }
 
-  void push_front(const_reference value) {
-    Node_ *new_node = new Node_(value);
+  // конструирует элемент на месте в начале списка
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    Node_ *new_node = AllocateNode(std::forward<Args>(args)...);
     if (head_ == nullptr) {
       head_ = tail_ = new_node;
     } else {
@@ -234,7 +274,8 @@ class list {
       head_ = new_node;
     }
     size_++;
-  };
+    return new_node->data;
+  }
 
   void pop_front() {
     if (head_ == nullptr) return;
@@ -245,7 +286,7 @@ class list {
     } else {
       tail_ = nullptr;
     }
-    delete head_;
+    DeallocateDestroyNode(head_);
     head_ = tmp_node;
     size_--;
   }
@@ -259,7 +300,7 @@ class list {
     } else {
       head_ = tmp_node;
     }
-    delete tail_;
+    DeallocateDestroyNode(tail_);
     tail_ = tmp_node;
     size_--;
   };
@@ -268,10 +309,22 @@ class list {
     while (head_ != nullptr && tail_ != nullptr) {
       pop_front();
     }
+    ReleaseNodes(alloc_node_);
   };
 
   iterator insert(iterator pos, const_reference value) {
-    Node_ *newNode = new Node_(value);
+    return emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // конструирует элемент на месте перед pos (после последнего, если pos ==
+  // end(), как и insert)
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args) {
+    Node_ *newNode = AllocateNode(std::forward<Args>(args)...);
     if (pos.get_node() == tail_) {
       if (empty()) {
         head_ = newNode;
@@ -326,48 +379,46 @@ class list {
       tail_ = nullptr;
     }
 
-    delete current;
+    DeallocateDestroyNode(current);
     size_--;
   }
 
   void swap(list &other) noexcept {
+    std::swap(alloc_node_, other.alloc_node_);
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
   }
 
-  void merge(list &other) {
-    list result;
-    iterator this_begin = begin();
-    iterator other_begin = other.begin();
-    if (other.empty()) {
-      return;
-    }
-    if (empty()) {
-      other.sort();
-      *this = std::move(other);
+  // Слияние двух отсортированных списков за O(n + m) без выделения памяти:
+  // узлы other перевешиваются в *this, other становится пустым. Слияние
+  // устойчивое: из равных элементов первыми идут элементы *this. Если
+  // аллокаторы списков не равны, элементы other переносятся в новые узлы.
+  void merge(list &other) { merge(other, std::less<value_type>()); }
+
+  template <typename Compare>
+  void merge(list &other, Compare comp) {
+    if (this == &other || other.head_ == nullptr) {
       return;
     }
-    while (this_begin != ++end()) {
-      result.push_back(*this_begin);
-      this_begin++;
-    }
-    while (other_begin != ++other.end()) {
-      result.push_back(*other_begin);
-      other_begin++;
-    }
-    result.sort();
-    clear();
-    *this = std::move(result);
+    size_type count = other.size_;
+    Node_ *last = nullptr;
+    head_ = MergeNodes(head_, TakeNodes(other, last), comp);
+    RelinkPrev();
+    size_ += count;
   }
 
+  // Узлы other перевешиваются без копирования, если у списков общий
+  // аллокатор; иначе элементы переносятся в узлы из аллокатора *this, чтобы
+  // каждый узел вернулся в тот пул, из которого был взят.
   void splice(const_iterator pos, list &other) {
-    // находим наши узлы
-    Node_ *target_node = const_cast<s21::list<int>::Node_ *>(pos.get_node());
-    Node_ *first_node_other = other.head_;
-    Node_ *last_node_other = other.tail_;
-    if (other.head_ == nullptr)
+    if (this == &other || other.head_ == nullptr)
       return;  // если список пуст, то ничего не делаем
+    // находим наши узлы
+    Node_ *target_node = const_cast<Node_ *>(pos.get_node());
+    size_type count = other.size_;
+    Node_ *last_node_other = nullptr;
+    Node_ *first_node_other = TakeNodes(other, last_node_other);
     if (target_node != nullptr) {  // Обновляем указатели в начальном списке
       Node_ *prev_target_node = target_node->prev;
       if (prev_target_node != nullptr) {
@@ -390,10 +441,26 @@ class list {
       }
       tail_ = last_node_other;
     }
-    size_ += other.size_;
-    other.size_ = 0;
-    other.head_ = nullptr;
-    other.tail_ = nullptr;
+    size_ += count;
+  }
+
+  // Перевешивает узел it из other перед pos (в конец, если pos пуст) за O(1);
+  // other может быть самим *this. При разных аллокаторах элемент переносится
+  // в новый узел из аллокатора *this.
+  void splice(const_iterator pos, list &other, const_iterator it) {
+    Node_ *node = const_cast<Node_ *>(it.get_node());
+    Node_ *target = const_cast<Node_ *>(pos.get_node());
+    if (node == nullptr || node == target) {
+      return;
+    }
+    if (alloc_node_ == other.alloc_node_) {
+      other.UnlinkNode(node);
+    } else {
+      Node_ *copy = AllocateNode(std::move(node->data));
+      other.erase(iterator(node));
+      node = copy;
+    }
+    LinkNodeBefore(node, target);
   }
 
   void reverse() noexcept {
@@ -426,19 +493,18 @@ class list {
     }
   }
 
-  void sort() {
-    for (auto iter = begin(); iter != ++end(); ++iter) {
-      for (auto innerIter = begin(); innerIter != ++end(); ++innerIter) {
-        auto nextIter = innerIter;
-        ++nextIter;
+  // Устойчивая сортировка слиянием за O(n log n): переставляются узлы,
+  // элементы не копируются и не перемещаются.
+  void sort() { sort(std::less<value_type>()); }
 
-        if (nextIter != ++end()) {
-          if (*innerIter > *nextIter) {
-            std::swap(*innerIter, *nextIter);
-          }
-        }
-      }
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) {
+      return;
     }
+    Node_ *first = head_;
+    head_ = SortNodes(first, size_, comp);
+    RelinkPrev();
   }
 
   // вспомогательные методы
@@ -450,9 +516,124 @@ class list {
 
   //-------------- END PUBLIC --------------------
  private:
+  NodeAlloc alloc_node_;
   Node_ *head_;
   Node_ *tail_;
   size_t size_;
+
+  template <typename... Args>
+  Node_ *AllocateNode(Args &&...args) {
+    Node_ *node = std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
+    try {
+      std::allocator_traits<NodeAlloc>::construct(
+          alloc_node_, node, std::in_place, std::forward<Args>(args)...);
+    } catch (...) {
+      std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DeallocateDestroyNode(Node_ *node) noexcept {
+    std::allocator_traits<NodeAlloc>::destroy(alloc_node_, node);
+    std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, node, 1);
+  }
+
+  // Исключает узел из цепочки, не освобождая его.
+  void UnlinkNode(Node_ *node) noexcept {
+    (node->prev != nullptr ? node->prev->next : head_) = node->next;
+    (node->next != nullptr ? node->next->prev : tail_) = node->prev;
+    node->prev = nullptr;
+    node->next = nullptr;
+    --size_;
+  }
+
+  // Вставляет отдельный узел перед target или в конец, если target пуст.
+  void LinkNodeBefore(Node_ *node, Node_ *target) noexcept {
+    Node_ *prev = target != nullptr ? target->prev : tail_;
+    node->prev = prev;
+    node->next = target;
+    (prev != nullptr ? prev->next : head_) = node;
+    (target != nullptr ? target->prev : tail_) = node;
+    ++size_;
+  }
+
+  // Забирает все узлы other, который становится пустым, и возвращает
+  // цепочку с корректными prev и next; last получает ее последний узел.
+  // При разных аллокаторах цепочка строится из новых узлов *this.
+  Node_ *TakeNodes(list &other, Node_ *&last) {
+    Node_ *first = other.head_;
+    last = other.tail_;
+    if (!(alloc_node_ == other.alloc_node_)) {
+      first = nullptr;
+      last = nullptr;
+      try {
+        for (Node_ *node = other.head_; node != nullptr; node = node->next) {
+          Node_ *copy = AllocateNode(std::move(node->data));
+          copy->prev = last;
+          (last != nullptr ? last->next : first) = copy;
+          last = copy;
+        }
+      } catch (...) {
+        while (first != nullptr) {
+          Node_ *next = first->next;
+          DeallocateDestroyNode(first);
+          first = next;
+        }
+        throw;
+      }
+      other.clear();
+    }
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+    return first;
+  }
+
+  // Сортирует n узлов цепочки, начиная с first, по ссылкам next. Возвращает
+  // голову отсортированной цепочки, first сдвигается на следующий за ними узел.
+  template <typename Compare>
+  static Node_ *SortNodes(Node_ *&first, size_type n, Compare &comp) {
+    if (n == 1) {
+      Node_ *node = first;
+      first = first->next;
+      node->next = nullptr;
+      return node;
+    }
+    Node_ *left = SortNodes(first, n / 2, comp);
+    Node_ *right = SortNodes(first, n - n / 2, comp);
+    return MergeNodes(left, right, comp);
+  }
+
+  // Сливает две отсортированные цепочки по ссылкам next; при равенстве
+  // первым идет узел из left, поэтому слияние устойчивое.
+  template <typename Compare>
+  static Node_ *MergeNodes(Node_ *left, Node_ *right, Compare &comp) {
+    Node_ *head = nullptr;
+    Node_ **link = &head;
+    while (left != nullptr && right != nullptr) {
+      if (comp(right->data, left->data)) {
+        *link = right;
+        right = right->next;
+      } else {
+        *link = left;
+        left = left->next;
+      }
+      link = &(*link)->next;
+    }
+    *link = left != nullptr ? left : right;
+    return head;
+  }
+
+  // Восстанавливает ссылки prev и tail_ после перестановки по next.
+  void RelinkPrev() noexcept {
+    Node_ *prev = nullptr;
+    for (Node_ *node = head_; node != nullptr; node = node->next) {
+      node->prev = prev;
+      prev = node;
+    }
+    tail_ = prev;
+  }
 };
 }  // namespace s21
 
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -460,6 +463,61 @@ TEST(List, Merge) {
   EXPECT_EQ(*it, 2);
 }
 
+TEST(List, Merge_MovesNodes) {
+  s21::list<std::string> list1 = {"b", "d"};
+  s21::list<std::string> list2 = {"a", "c", "e"};
+  const std::string *c = &*(++list2.begin());
+  list1.merge(list2);
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list1.size(), 5u);
+  EXPECT_EQ(&*(++(++list1.begin())), c);
+  EXPECT_EQ(list1.front(), "a");
+  EXPECT_EQ(list1.back(), "e");
+  auto it = list1.end();
+  for (const char *expected : {"e", "d", "c", "b", "a"}) {
+    EXPECT_EQ(*it, expected);
+    --it;
+  }
+  list2.push_back("z");
+  EXPECT_EQ(list2.front(), "z");
+}
+
+TEST(List, Merge_IsStable) {
+  using Item = std::pair<int, char>;
+  s21::list<Item> list1 = {{1, 'a'}, {2, 'a'}, {2, 'b'}};
+  s21::list<Item> list2 = {{1, 'x'}, {2, 'x'}, {3, 'x'}};
+  auto by_first = [](const Item &a, const Item &b) {
+    return a.first < b.first;
+  };
+  list1.merge(list2, by_first);
+  std::vector<Item> expected = {{1, 'a'}, {1, 'x'}, {2, 'a'},
+                                {2, 'b'}, {2, 'x'}, {3, 'x'}};
+  auto it = list1.begin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+}
+
+TEST(List, Merge_WithComparator) {
+  s21::list<int> list1 = {9, 5, 1};
+  s21::list<int> list2 = {8, 6, 2, 0};
+  list1.merge(list2, std::greater<int>());
+  std::list<int> expected = {9, 8, 6, 5, 2, 1, 0};
+  auto it = list1.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(list1.back(), 0);
+}
+
+TEST(List, Merge_Self) {
+  s21::list<int> list1 = {1, 2};
+  list1.merge(list1);
+  EXPECT_EQ(list1.size(), 2u);
+}
+
 TEST(ListTest, SortTest) {
   s21::list<int> myList;
 
@@ -485,6 +543,76 @@ TEST(ListTest, SortTest) {
   EXPECT_EQ(*it, 8);
 }
 
+TEST(ListTest, SortMatchesStdList) {
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  unsigned value = 21;
+  for (int i = 0; i < 1000; ++i) {
+    value = value * 1103515245u + 12345u;
+    s21_list.push_back(static_cast<int>(value % 100));
+    std_list.push_back(static_cast<int>(value % 100));
+  }
+  s21_list.sort();
+  std_list.sort();
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  auto it = s21_list.begin();
+  for (int expected : std_list) {
+    EXPECT_EQ(*it, expected);
+    ++it;
+  }
+  EXPECT_EQ(s21_list.back(), std_list.back());
+}
+
+TEST(ListTest, SortKeepsLinks) {
+  s21::list<int> myList = {3, 1, 2};
+  myList.sort();
+  auto it = myList.end();
+  EXPECT_EQ(*it, 3);
+  --it;
+  EXPECT_EQ(*it, 2);
+  --it;
+  EXPECT_EQ(*it, 1);
+  myList.push_back(4);
+  myList.push_front(0);
+  EXPECT_EQ(myList.front(), 0);
+  EXPECT_EQ(myList.back(), 4);
+  EXPECT_EQ(myList.size(), 5u);
+}
+
+TEST(ListTest, SortWithComparatorIsStable) {
+  s21::list<std::pair<int, int>> myList = {{2, 0}, {1, 1}, {2, 2},
+                                           {1, 3}, {3, 4}, {1, 5}};
+  myList.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first > b.first;
+  });
+  std::vector<std::pair<int, int>> expected = {{3, 4}, {2, 0}, {2, 2},
+                                               {1, 1}, {1, 3}, {1, 5}};
+  auto it = myList.begin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+}
+
+TEST(ListTest, SortDoesNotCopyElements) {
+  s21::list<std::string> myList = {"pear", "apple", "fig"};
+  const std::string *apple = &*(++myList.begin());
+  myList.sort();
+  EXPECT_EQ(&*myList.begin(), apple);
+  EXPECT_EQ(myList.front(), "apple");
+  EXPECT_EQ(myList.back(), "pear");
+}
+
+TEST(ListTest, SortEmptyAndSingle) {
+  s21::list<int> empty;
+  empty.sort();
+  EXPECT_TRUE(empty.empty());
+  s21::list<int> single = {7};
+  single.sort();
+  EXPECT_EQ(single.front(), 7);
+  EXPECT_EQ(single.back(), 7);
+}
+
 TEST(ListTest, MoveAssignmentWithNonEmptyList) {
   // Создаем два списка
   s21::list<int> list1;
@@ -518,4 +646,223 @@ TEST(ListIterator, IteratorBegin) {
 
   auto it = myList.begin();
   EXPECT_EQ(*it, 1);
-}
\ No newline at end of file
+}
+
+TEST(ListEmplace, EmplaceFrontBack) {
+  s21::list<std::pair<int, std::string>> myList;
+  myList.emplace_back(2, "two");
+  auto &front = myList.emplace_front(1, "one");
+  EXPECT_EQ(front.second, "one");
+  EXPECT_EQ(myList.front().first, 1);
+  EXPECT_EQ(myList.back().second, "two");
+  EXPECT_EQ(myList.size(), 2u);
+}
+
+TEST(ListEmplace, EmplaceMiddle) {
+  s21::list<std::string> myList = {"a", "c", "d"};
+  auto pos = myList.begin();
+  ++pos;
+  auto it = myList.emplace(pos, 2, 'b');
+  EXPECT_EQ(*it, "bb");
+  std::vector<std::string> expected = {"a", "bb", "c", "d"};
+  ASSERT_EQ(myList.size(), expected.size());
+  auto iter = myList.begin();
+  for (size_t i = 0; i < expected.size(); ++i, ++iter) {
+    EXPECT_EQ(*iter, expected[i]);
+  }
+}
+
+TEST(ListEmplace, MoveOnly) {
+  s21::list<std::unique_ptr<int>> myList;
+  myList.push_back(std::make_unique<int>(2));
+  myList.push_front(std::make_unique<int>(1));
+  myList.insert(myList.begin(), std::make_unique<int>(0));
+  ASSERT_EQ(myList.size(), 3u);
+  auto it = myList.begin();
+  for (int expected = 0; expected < 3; ++expected, ++it) {
+    EXPECT_EQ(**it, expected);
+  }
+}
+
+TEST(ListEmplace, PushBackRvalueMoves) {
+  s21::list<std::string> myList;
+  std::string value(100, 'a');
+  myList.push_back(std::move(value));
+  EXPECT_EQ(myList.back(), std::string(100, 'a'));
+  EXPECT_TRUE(value.empty());
+}
+
+namespace {
+
+// живые объекты, выделенные через CountingAllocator любого типа
+int live_objects = 0;
+
+// Считает объекты, выделенные через аллокатор списка, в том числе после
+// перепривязки к типу узла.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    live_objects += static_cast<int>(n);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, size_t n) {
+    live_objects -= static_cast<int>(n);
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U> &) const {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U> &) const {
+    return false;
+  }
+};
+
+using PoolList = s21::list<int, s21::PoolAllocator<int>>;
+
+std::vector<int> Items(PoolList &l) {
+  std::vector<int> items;
+  if (!l.empty()) {
+    for (auto it = l.begin(), last = ++l.end(); it != last; ++it) {
+      items.push_back(*it);
+    }
+  }
+  return items;
+}
+
+}  // namespace
+
+TEST(ListAllocator, EveryNodeGoesThroughAlloc) {
+  {
+    s21::list<std::string, CountingAllocator<std::string>> l;
+    l.push_back("a");
+    l.push_front("b");
+    l.emplace(l.begin(), 3, 'c');
+    EXPECT_EQ(live_objects, 3);
+    l.pop_back();
+    l.erase(l.begin());
+    EXPECT_EQ(live_objects, 1);
+    s21::list<std::string, CountingAllocator<std::string>> other{"d", "e"};
+    l.splice(l.c_begin(), other);
+    EXPECT_EQ(live_objects, 3);
+  }
+  EXPECT_EQ(live_objects, 0);
+}
+
+// Узел, освобожденный pop_back, выдается следующей вставке
+TEST(ListAllocator, PoolRecyclesFreedNodes) {
+  PoolList l{1, 2, 3};
+  auto *freed = l.end().get_node();
+  l.pop_back();
+  l.push_front(0);
+  EXPECT_EQ(l.begin().get_node(), freed);
+  for (int i = 0; i < 100000; ++i) {
+    l.push_front(i);
+    l.pop_back();
+  }
+  EXPECT_EQ(l.size(), 3u);
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  l.push_back(7);
+  EXPECT_EQ(Items(l), (std::vector<int>{7}));
+}
+
+// Списки, построенные из одного аллокатора, делят пул: merge и splice
+// перевешивают сами узлы, не выделяя новых
+TEST(ListAllocator, SpliceAndMergeWithinOnePool) {
+  s21::PoolAllocator<int> alloc;
+  PoolList a(alloc);
+  PoolList b(alloc);
+  for (int i : {1, 4, 6}) {
+    a.push_back(i);
+  }
+  for (int i : {2, 3, 5}) {
+    b.push_back(i);
+  }
+  EXPECT_TRUE(a.get_allocator() == b.get_allocator());
+  auto *two = b.begin().get_node();
+  auto *five = b.end().get_node();
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(Items(a), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ((++a.begin()).get_node(), two);
+  EXPECT_EQ((--a.end()).get_node(), five);
+  PoolList c(alloc);
+  c.push_back(0);
+  auto *one = a.begin().get_node();
+  c.splice(PoolList::const_iterator(), a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(Items(c), (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ((++c.begin()).get_node(), one);
+  b.splice(b.c_begin(), c, PoolList::const_iterator(five));
+  EXPECT_EQ(b.begin().get_node(), five);
+  EXPECT_EQ(Items(c), (std::vector<int>{0, 1, 2, 3, 4, 6}));
+  // у списка по умолчанию свой пул: элементы переносятся в узлы c
+  PoolList other{7, 8};
+  EXPECT_TRUE(other.get_allocator() != c.get_allocator());
+  c.splice(PoolList::const_iterator(), other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(Items(c), (std::vector<int>{0, 1, 2, 3, 4, 6, 7, 8}));
+  other.push_back(9);
+  EXPECT_EQ(Items(other), (std::vector<int>{9}));
+}
+
+// С общим аллокатором splice перевешивает сами узлы
+TEST(ListAllocator, SpliceWithEqualAllocatorsKeepsNodes) {
+  s21::list<int> l{1, 2};
+  s21::list<int> other{3, 4};
+  auto *node = other.begin().get_node();
+  l.splice(s21::list<int>::const_iterator(), other);
+  EXPECT_EQ(l.size(), 4u);
+  EXPECT_EQ((++++l.begin()).get_node(), node);
+}
+
+TEST(ListAllocator, MoveAndSwapCarryThePool) {
+  PoolList a{1, 2, 3};
+  PoolList b{4, 5};
+  b = std::move(a);
+  EXPECT_EQ(Items(b), (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(a.empty());
+  PoolList c(std::move(b));
+  a.push_back(8);
+  a.swap(c);
+  EXPECT_EQ(Items(a), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(Items(c), (std::vector<int>{8}));
+  a.pop_front();
+  c.pop_front();
+  EXPECT_EQ(Items(a), (std::vector<int>{2, 3}));
+}
+
+TEST(List, SpliceOneElement) {
+  s21::list<int> l{1, 2, 3, 4};
+  s21::list<int> other{5, 6};
+  l.splice(l.c_begin(), l, s21::list<int>::const_iterator(l.end().get_node()));
+  l.splice(s21::list<int>::const_iterator(), other, other.c_begin());
+  l.splice(l.c_begin(), l, l.c_begin());
+  std::vector<int> items;
+  for (auto it = l.begin(), last = ++l.end(); it != last; ++it) {
+    items.push_back(*it);
+  }
+  EXPECT_EQ(items, (std::vector<int>{4, 1, 2, 3, 5}));
+  EXPECT_EQ(l.size(), 5u);
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.front(), 6);
+  EXPECT_EQ(other.back(), 6);
+  s21::list<int, s21::PoolAllocator<int>> pooled{7};
+  s21::list<int, s21::PoolAllocator<int>> source{8, 9};
+  pooled.splice(pooled.c_begin(), source, source.c_begin());
+  EXPECT_EQ(pooled.front(), 8);
+  EXPECT_EQ(pooled.size(), 2u);
+  EXPECT_EQ(source.front(), 9);
+  EXPECT_EQ(source.size(), 1u);
+}
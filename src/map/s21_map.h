@@ -12,10 +12,11 @@ class MapCommonIterator;
 
 template <typename Key, typename T, typename Compare = std::less<Key>,
           typename Alloc = std::allocator<T>>
-class Map : public Tree<Key, T> {
+class Map : public Tree<Key, T, Compare, Alloc> {
  public:
   using key_type = Key;
   using mapped_type = T;
+  using key_compare = Compare;
   using value_type = std::pair<const Key, T>;
   using reference = value_type&;
   using const_reference = const value_type&;
@@ -23,13 +24,15 @@ class Map : public Tree<Key, T> {
   using const_pointer = const value_type*;
   using NodeAlloc = typename std::allocator_traits<
       Alloc>::template rebind_alloc<Node<key_type, mapped_type>>;
-  using DataAlloc = typename std::allocator_traits<
-      Alloc>::template rebind_alloc<std::pair<const Key, T>>;
-  using iterator = TreeCommonIterator<key_type, mapped_type, false>;
-  using const_iterator = TreeCommonIterator<key_type, mapped_type, true>;
+  using allocator_type = Alloc;
+  using iterator =
+      TreeCommonIterator<key_type, mapped_type, false, Compare, Alloc>;
+  using const_iterator =
+      TreeCommonIterator<key_type, mapped_type, true, Compare, Alloc>;
   using size_type = size_t;
+  using range_view = typename Tree<Key, T, Compare, Alloc>::range_view;
 
-  friend class Tree<Key, T>;
+  friend class Tree<Key, T, Compare, Alloc>;
 
   Map() : tree_(){};
 
@@ -39,16 +42,14 @@ class Map : public Tree<Key, T> {
     }
   };
 
-  Map(const Map& m) : Tree<key_type, mapped_type, Compare, Alloc>(m.tree_) {
-    tree_.CopyElementsForTree(m.tree_);
-  };
+  Map(const Map& m) : Tree<Key, T, Compare, Alloc>(), tree_(m.tree_){};
 
   Map(Map&& m) { tree_.MoveTree(std::move(m.tree_)); }
 
   Map& operator=(Map&& m) {
     if (this != &m) {
       clear();
-      Map new_map(std::move(m.tree_));
+      Map new_map(std::move(m));
       swap(new_map);
     }
     return *this;
@@ -57,7 +58,7 @@ class Map : public Tree<Key, T> {
   Map& operator=(const Map& m) {
     if (this != &m) {
       clear();
-      Map new_map(m.tree_);
+      Map new_map(m);
       swap(new_map);
     }
     return *this;
@@ -98,23 +99,103 @@ class Map : public Tree<Key, T> {
     return iter;
   };
 
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return tree_.insert(std::move(value));
+  };
+
   std::pair<iterator, bool> insert(const key_type& key,
                                    const mapped_type& obj) {
     auto iter = tree_.insert(key, obj);
     return iter;
   };
 
+  // a range sorted by key is merged in linear time
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    tree_.insert(first, last);
+  };
+
+  // Builds a balanced tree from a range sorted by key in O(n); repeated keys
+  // keep their first value, an unsorted range throws std::invalid_argument.
+  template <typename InputIt>
+  static Map from_sorted(InputIt first, InputIt last) {
+    Map result;
+    result.tree_.InsertSorted(first, last);
+    return result;
+  };
+
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const mapped_type& obj) {
     auto iter = tree_.insert_or_assign(key, obj);
     return iter;
   };
 
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             mapped_type&& obj) {
+    return tree_.insert_or_assign(key, std::move(obj));
+  };
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  };
+
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  };
+
   void erase(iterator pos) { tree_.erase(pos); };
   void swap(Map& other) { tree_.swap(other.tree_); };
   void merge(Map& other) { tree_.merge(other.tree_); };
   bool contains(const Key& key) const { return tree_.contains(key); };
 
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const {
+    return tree_.contains(key);
+  };
+
+  iterator find(const key_type& key) { return tree_.find(key); };
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  };
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); };
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  };
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); };
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  };
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return tree_.equal_range(key);
+  };
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return tree_.equal_range(key);
+  };
+
+  // lazy view of the elements with lo <= key < hi
+  range_view range(const key_type& lo, const key_type& hi) {
+    return tree_.range(lo, hi);
+  };
+
  private:
   Tree<key_type, mapped_type, Compare, Alloc> tree_;
 };
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <memory>
+#include <random>
 #include <string>
+#include <string_view>
 
 #include "../s21_containers.h"
 
@@ -199,16 +202,27 @@ TEST(TestMapSize, SizeSecond) {
   ASSERT_EQ(m.size(), m2.size());
 }
 
+// s21 nodes carry two thread links more than std::map nodes, so the bound
+// is that of the allocator for s21::Node rather than std::map's
+template <typename Key, typename T>
+size_t NodeMaxSize() {
+  std::allocator<s21::Node<Key, T>> alloc;
+  return std::allocator_traits<std::allocator<s21::Node<Key, T>>>::max_size(
+      alloc);
+}
+
 TEST(TestMapMaxSize, MaxSizeFirst) {
   s21::Map<int, int> m{{1, 100}, {-3, 100}, {6, 100}};
   std::map<int, int> m2{{1, 100}, {-3, 100}, {6, 100}};
-  ASSERT_EQ(m.max_size(), m2.max_size());
+  ASSERT_EQ(m.max_size(), (NodeMaxSize<int, int>()));
+  ASSERT_LE(m.max_size(), m2.max_size());
 }
 
 TEST(TestMapMaxSize, MaxSizeSecond) {
   s21::Map<int, int> m;
   std::map<int, int> m2;
-  ASSERT_EQ(m.max_size(), m2.max_size());
+  ASSERT_EQ(m.max_size(), (NodeMaxSize<int, int>()));
+  ASSERT_LE(m.max_size(), m2.max_size());
 }
 
 TEST(TestMapMaxSize, MaxSizeThird) {
@@ -216,7 +230,8 @@ TEST(TestMapMaxSize, MaxSizeThird) {
                         {'n', 4}, {'a', 5}, {'w', 6}};
   std::map<char, int> m2{{'t', 1}, {'s', 2}, {'i', 3},
                          {'n', 4}, {'a', 5}, {'w', 6}};
-  ASSERT_EQ(m.max_size(), m2.max_size());
+  ASSERT_EQ(m.max_size(), (NodeMaxSize<char, int>()));
+  ASSERT_LE(m.max_size(), m2.max_size());
 }
 
 TEST(TestMapClear, ClearFirst) {
@@ -2073,6 +2088,432 @@ TEST(TestMapErase, TestMapEraseThirtiethSecond) {
   m.erase(it);
 }
 
+TEST(TestMapIterator, IteratorShuffledKeys) {
+  s21::Map<int, int> m;
+  std::map<int, int> m2;
+  for (int i = 0; i < 200; ++i) {
+    int key = (i * 37) % 200 + 1;
+    m.insert(key, i);
+    m2.insert({key, i});
+  }
+  auto it2 = m2.begin();
+  size_t count = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++it2, ++count) {
+    ASSERT_EQ((*it).first, it2->first);
+    ASSERT_EQ((*it).second, it2->second);
+  }
+  ASSERT_EQ(count, m2.size());
+}
+
+TEST(TestMapInsert, InsertExistingKey) {
+  s21::Map<int, int> m = {{1, 10}, {2, 20}, {3, 30}};
+  std::map<int, int> m2 = {{1, 10}, {2, 20}, {3, 30}};
+  auto it = m.insert(2, 200);
+  auto it2 = m2.insert({2, 200});
+  ASSERT_EQ(it.second, it2.second);
+  ASSERT_EQ((*it.first).first, it2.first->first);
+  ASSERT_EQ((*it.first).second, it2.first->second);
+  ASSERT_EQ(m.size(), m2.size());
+}
+
+TEST(TestMapInsert, InsertReturnsInsertedNode) {
+  s21::Map<int, int> m;
+  for (int i = 0; i < 300; ++i) {
+    int key = (i * 53) % 300 + 1;
+    auto it = m.insert(key, i);
+    ASSERT_TRUE(it.second);
+    ASSERT_EQ((*it.first).first, key);
+    ASSERT_EQ((*it.first).second, i);
+  }
+  ASSERT_EQ(m.size(), 300u);
+}
+
+TEST(TestMapInsertOrAssign, InsertOrAssignExistingKey) {
+  s21::Map<int, int> m = {{1, 10}, {2, 20}};
+  auto it = m.insert_or_assign(2, 200);
+  ASSERT_FALSE(it.second);
+  ASSERT_EQ((*it.first).first, 2);
+  ASSERT_EQ((*it.first).second, 200);
+  ASSERT_EQ(m[2], 200);
+  ASSERT_EQ(m.size(), 2u);
+}
+
+TEST(TestMapErase, EraseLastThenInsert) {
+  s21::Map<int, int> m = {{30, 4}};
+  m.erase(m.begin());
+  ASSERT_TRUE(m.empty());
+  auto it = m.insert(30, 5);
+  ASSERT_TRUE(it.second);
+  ASSERT_EQ(m[30], 5);
+  ASSERT_EQ(m.size(), 1u);
+}
+
+TEST(TestMapFind, FindFirst) {
+  s21::Map<int, int> m = {{5, 50}, {1, 10}, {9, 90}, {3, 30}};
+  auto it = m.find(3);
+  ASSERT_TRUE(it != m.end());
+  ASSERT_EQ((*it).second, 30);
+  ASSERT_TRUE(m.find(4) == m.end());
+}
+
+TEST(TestMapFind, FindEmpty) {
+  s21::Map<int, int> m;
+  ASSERT_TRUE(m.find(1) == m.end());
+  ASSERT_TRUE(m.lower_bound(1) == m.end());
+  ASSERT_TRUE(m.upper_bound(1) == m.end());
+}
+
+TEST(TestMapFind, BoundsFirst) {
+  s21::Map<int, int> m = {{10, 1}, {20, 2}, {30, 3}, {40, 4}};
+  std::map<int, int> m2 = {{10, 1}, {20, 2}, {30, 3}, {40, 4}};
+  for (int key = 5; key <= 40; key += 5) {
+    ASSERT_EQ((*m.lower_bound(key)).first, m2.lower_bound(key)->first);
+    if (key < 40) {
+      ASSERT_EQ((*m.upper_bound(key)).first, m2.upper_bound(key)->first);
+    }
+  }
+  ASSERT_TRUE(m.upper_bound(40) == m.end());
+  ASSERT_TRUE(m.lower_bound(41) == m.end());
+}
+
+TEST(TestMapFind, EqualRange) {
+  s21::Map<int, int> m = {{10, 1}, {20, 2}, {30, 3}};
+  auto range = m.equal_range(20);
+  ASSERT_EQ((*range.first).first, 20);
+  ASSERT_EQ((*range.second).first, 30);
+  range = m.equal_range(25);
+  ASSERT_TRUE(range.first == range.second);
+  ASSERT_EQ((*range.first).first, 30);
+}
+
+TEST(TestMapFind, TransparentComparator) {
+  s21::Map<std::string, int, std::less<>> m = {
+      {"alpha", 1}, {"beta", 2}, {"gamma", 3}};
+  std::string_view key = "beta";
+  ASSERT_TRUE(m.contains(key));
+  ASSERT_EQ((*m.find(key)).second, 2);
+  ASSERT_TRUE(m.find(std::string_view("delta")) == m.end());
+  ASSERT_EQ((*m.lower_bound(std::string_view("b"))).first, "beta");
+  ASSERT_EQ((*m.upper_bound(std::string_view("beta"))).first, "gamma");
+  auto range = m.equal_range("gamma");
+  ASSERT_EQ((*range.first).second, 3);
+  ASSERT_TRUE(range.second == m.end());
+}
+
+TEST(TestMapFind, CustomComparator) {
+  s21::Map<int, int, std::greater<int>> m = {{1, 1}, {3, 3}, {2, 2}};
+  std::map<int, int, std::greater<int>> m2 = {{1, 1}, {3, 3}, {2, 2}};
+  auto it2 = m2.begin();
+  for (auto it = m.begin(); it != m.end(); ++it, ++it2) {
+    ASSERT_EQ((*it).first, it2->first);
+  }
+  ASSERT_EQ((*m.lower_bound(2)).first, m2.lower_bound(2)->first);
+  ASSERT_EQ(m.at(3), 3);
+  ASSERT_TRUE(m.contains(1));
+}
+
+TEST(TestMapEmplace, EmplaceInPlace) {
+  s21::Map<int, std::string> m;
+  auto result = m.emplace(1, "one");
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(result.first->second, "one");
+  auto duplicate = m.emplace(1, "uno");
+  ASSERT_FALSE(duplicate.second);
+  ASSERT_EQ(duplicate.first->second, "one");
+  m.emplace(std::piecewise_construct, std::forward_as_tuple(2),
+            std::forward_as_tuple(3, 'x'));
+  ASSERT_EQ(m.at(2), "xxx");
+  auto hinted = m.emplace_hint(m.begin(), 0, "zero");
+  ASSERT_EQ(hinted->first, 0);
+  ASSERT_EQ(m.size(), 3u);
+}
+
+TEST(TestMapEmplace, MoveOnlyMapped) {
+  s21::Map<int, std::unique_ptr<int>> m;
+  for (int i = 0; i < 50; ++i) {
+    m.emplace(i, std::make_unique<int>(i));
+  }
+  m.insert(std::make_pair(100, std::make_unique<int>(100)));
+  m.insert_or_assign(10, std::make_unique<int>(-10));
+  m[200] = std::make_unique<int>(200);
+  ASSERT_EQ(m.size(), 52u);
+  ASSERT_EQ(*m.at(10), -10);
+  ASSERT_EQ(*m.at(100), 100);
+  ASSERT_EQ(*m.at(200), 200);
+  int expected = 0;
+  for (auto it = m.begin(); expected < 50; ++it, ++expected) {
+    ASSERT_EQ(it->first, expected);
+  }
+}
+
+TEST(TestMapEmplace, InsertRvalueMoves) {
+  s21::Map<int, std::string> m;
+  std::pair<const int, std::string> value(1, std::string(100, 'a'));
+  m.insert(std::move(value));
+  ASSERT_EQ(m.at(1), std::string(100, 'a'));
+  ASSERT_TRUE(value.second.empty());
+}
+
+TEST(TestMapEmplace, EmplaceAfterEraseAll) {
+  s21::Map<int, int> m{{1, 1}, {2, 2}};
+  m.erase(m.find(1));
+  m.erase(m.find(2));
+  ASSERT_TRUE(m.empty());
+  m.emplace(3, 3);
+  ASSERT_EQ(m.begin()->first, 3);
+  ASSERT_TRUE(++m.begin() == m.end());
+}
+
+// Black height of the subtree, or -1 if a red-black property, the key
+// order or a parent link is broken. The fake node counts as a leaf.
+template <typename Node>
+int CheckMapRedBlack(const Node* node, const Node* parent, const Node* fake) {
+  if (node == nullptr || node == fake) {
+    return 1;
+  }
+  if (node->parent_ != parent) {
+    return -1;
+  }
+  for (const Node* child : {node->left_, node->right_}) {
+    if (child != nullptr && child != fake && node->color_ == s21::red &&
+        child->color_ == s21::red) {
+      return -1;
+    }
+  }
+  if (node->left_ != nullptr && node->left_ != fake &&
+      !(node->left_->data_.first < node->data_.first)) {
+    return -1;
+  }
+  if (node->right_ != nullptr && node->right_ != fake &&
+      !(node->data_.first < node->right_->data_.first)) {
+    return -1;
+  }
+  int left = CheckMapRedBlack(node->left_, node, fake);
+  int right = CheckMapRedBlack(node->right_, node, fake);
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  return left + (node->color_ == s21::red ? 0 : 1);
+}
+
+// Whether the thread of the tree, read forwards from the fake node, visits
+// the nodes in the same order as an in-order walk of the tree links, with
+// every prev_ undoing the next_ before it.
+template <typename Node>
+bool CheckMapThread(const Node* root, const Node* fake) {
+  std::vector<const Node*> in_order;
+  std::vector<const Node*> stack;
+  for (const Node* node = root; node != nullptr || !stack.empty();) {
+    if (node != nullptr) {
+      stack.push_back(node);
+      node = node->left_;
+    } else {
+      in_order.push_back(stack.back());
+      node = stack.back()->right_;
+      stack.pop_back();
+    }
+  }
+  const Node* node = fake;
+  for (const Node* expected : in_order) {
+    if (node->next_ != expected || expected->prev_ != node) {
+      return false;
+    }
+    node = expected;
+  }
+  return node->next_ == fake && fake->prev_ == node;
+}
+
+TEST(TestMapThread, ThreadFollowsInsertAndErase) {
+  using Node = s21::Node<int, int>;
+  s21::Tree<int, int> tree;
+  std::map<int, int> expected;
+  std::mt19937 rng(22);
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int step = 0; step < 20000; ++step) {
+    int k = key(rng);
+    if (rng() % 3 != 0) {
+      ASSERT_EQ(tree.insert(k, step).second, expected.insert({k, step}).second);
+    } else if (expected.erase(k) == 1) {
+      tree.erase(tree.find(k));
+    }
+    if (step % 500 == 0 && !tree.empty()) {
+      ASSERT_TRUE(CheckMapThread<Node>(tree.GetRoot(), tree.GetFakeNode()));
+    }
+  }
+  auto it = tree.end();
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    --it;
+    ASSERT_EQ((*it).first, rit->first);
+  }
+  ASSERT_TRUE(it == tree.begin());
+  std::vector<std::pair<int, int>> sorted;
+  for (int k = -500; k < 2500; k += 3) {
+    sorted.push_back({k, k});
+  }
+  tree.InsertSorted(sorted.begin(), sorted.end());
+  ASSERT_TRUE(CheckMapThread<Node>(tree.GetRoot(), tree.GetFakeNode()));
+  ASSERT_EQ((*tree.begin()).first, -500);
+  ASSERT_EQ((*--tree.end()).first, 2497);
+}
+
+TEST(TestMapBulk, FromSortedBuildsValidTree) {
+  for (int n : {1, 2, 3, 6, 7, 8, 100, 1000, 4095}) {
+    std::vector<std::pair<int, std::string>> items;
+    for (int i = 1; i <= n; ++i) {
+      items.push_back({i, std::to_string(i)});
+      if (i % 7 == 0) {
+        items.push_back({i, "repeat"});
+      }
+    }
+    auto m = s21::Map<int, std::string>::from_sorted(items.begin(),
+                                                     items.end());
+    ASSERT_EQ(m.size(), static_cast<size_t>(n));
+    int expected = 1;
+    for (auto it = m.begin(); it != m.end(); it++) {
+      ASSERT_EQ((*it).first, expected);
+      ASSERT_EQ((*it).second, std::to_string(expected));
+      ++expected;
+    }
+    ASSERT_EQ(expected, n + 1);
+    m.insert(0, "zero");
+    m.erase(m.find(1));
+    ASSERT_EQ(m.begin()->first, 0);
+    ASSERT_EQ(m.size(), static_cast<size_t>(n));
+  }
+}
+
+TEST(TestMapBulk, InsertSortedKeepsRedBlackInvariants) {
+  using Node = s21::Node<int, int>;
+  for (int n : {1, 2, 3, 6, 7, 8, 100, 1000, 4095}) {
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < n; ++i) {
+      items.push_back({2 * i, i});
+    }
+    s21::Tree<int, int> tree;
+    tree.insert(1, -1);
+    tree.insert(2, -2);
+    tree.InsertSorted(items.begin(), items.end());
+    ASSERT_EQ(tree.size(), static_cast<size_t>(n + (n > 1 ? 1 : 2)));
+    ASSERT_EQ(tree.at(2), -2);
+    ASSERT_GT(CheckMapRedBlack<Node>(tree.GetRoot(), nullptr,
+                                     tree.GetFakeNode()),
+              0);
+    tree.insert(-1, 0);
+    tree.erase(tree.find(1));
+    ASSERT_GT(CheckMapRedBlack<Node>(tree.GetRoot(), nullptr,
+                                     tree.GetFakeNode()),
+              0);
+    ASSERT_EQ((*tree.begin()).first, -1);
+  }
+}
+
+TEST(TestMapBulk, RangeInsertMergesSortedRange) {
+  s21::Map<int, int> m{{2, 20}, {4, 40}};
+  std::vector<std::pair<int, int>> sorted{{1, 1}, {2, 2}, {3, 3}, {5, 5}};
+  m.insert(sorted.begin(), sorted.end());
+  ASSERT_EQ(m.size(), 5u);
+  ASSERT_EQ(m.at(2), 20);
+  ASSERT_EQ(m.at(3), 3);
+  std::vector<std::pair<int, int>> unsorted{{9, 9}, {7, 7}};
+  m.insert(unsorted.begin(), unsorted.end());
+  ASSERT_EQ(m.size(), 7u);
+  ASSERT_THROW((s21::Map<int, int>::from_sorted(unsorted.begin(),
+                                                unsorted.end())),
+               std::invalid_argument);
+  std::vector<std::pair<int, int>> empty;
+  auto none = s21::Map<int, int>::from_sorted(empty.begin(), empty.end());
+  ASSERT_TRUE(none.empty());
+  none[1] = 1;
+  ASSERT_EQ(none.size(), 1u);
+}
+
+TEST(TestMapRange, RangeViewIsHalfOpenAndLazy) {
+  s21::Map<long, std::string> events;
+  for (long t = 1000; t < 2000; t += 100) {
+    events.insert(t, std::to_string(t));
+  }
+  std::vector<long> seen;
+  for (auto& event : events.range(1150, 1500)) {
+    seen.push_back(event.first);
+  }
+  ASSERT_EQ(seen, (std::vector<long>{1200, 1300, 1400}));
+
+  auto window = events.range(1800, 5000);
+  ASSERT_FALSE(window.empty());
+  ASSERT_TRUE(window.end() == events.end());
+  events.insert(1850, "late");  // the view sees later inserts
+  seen.clear();
+  for (auto it = window.begin(); it != window.end(); ++it) {
+    seen.push_back((*it).first);
+  }
+  ASSERT_EQ(seen, (std::vector<long>{1800, 1850, 1900}));
+
+  ASSERT_TRUE(events.range(1500, 1500).empty());
+  ASSERT_TRUE(events.range(1500, 1200).empty());
+  ASSERT_TRUE(events.range(0, 1000).empty());
+  s21::Map<long, std::string> none;
+  ASSERT_TRUE(none.range(0, 10).empty());
+}
+
+// std::allocator with a release() hook, counting how often the tree hands
+// its arena back
+inline int map_arena_releases = 0;
+
+template <typename T>
+struct ReleaseCountingAllocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = ReleaseCountingAllocator<U>;
+  };
+  ReleaseCountingAllocator() = default;
+  template <typename U>
+  ReleaseCountingAllocator(const ReleaseCountingAllocator<U>&) {}
+  void release() noexcept { ++map_arena_releases; }
+};
+
+TEST(TestMapErase, EraseLastKeepsArena) {
+  using Counting = ReleaseCountingAllocator<int>;
+  s21::Map<int, int, std::less<int>, Counting> m;
+  const int before = map_arena_releases;
+  for (int i = 0; i < 100; ++i) {
+    m.insert(i, i);
+    m.erase(m.begin());
+    ASSERT_TRUE(m.empty());
+    ASSERT_TRUE(m.begin() == m.end());
+  }
+  ASSERT_EQ(map_arena_releases, before);
+  m.insert(1, 1);
+  ASSERT_EQ(m.at(1), 1);
+  ASSERT_TRUE(++m.begin() == m.end());
+  m.clear();
+  ASSERT_EQ(map_arena_releases, before + 1);
+}
+
+// Remembers which instance compared last. A copy keeps the tag of its
+// source; a default-constructed one gets a new tag.
+struct TaggedLess {
+  static inline int next_tag = 0;
+  static inline int last_tag = -1;
+  int tag = next_tag++;
+  bool operator()(int lhs, int rhs) const {
+    last_tag = tag;
+    return lhs < rhs;
+  }
+};
+
+TEST(TestMapConstructor, CopyAndMoveKeepComparator) {
+  s21::Map<int, int, TaggedLess> m{{1, 1}, {2, 2}, {3, 3}};
+  m.find(2);
+  const int tag = TaggedLess::last_tag;
+  s21::Map<int, int, TaggedLess> copy(m);
+  copy.find(2);
+  ASSERT_EQ(TaggedLess::last_tag, tag);
+  s21::Map<int, int, TaggedLess> moved(std::move(copy));
+  moved.find(2);
+  ASSERT_EQ(TaggedLess::last_tag, tag);
+  ASSERT_EQ(moved.at(3), 3);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,211 @@
+#ifndef _SHARDED_MAP_H_
+#define _SHARDED_MAP_H_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+
+#include "s21_map.h"
+
+namespace s21 {
+
+// Map for many threads: keys are hashed to one of Shards independent trees,
+// each behind its own reader/writer lock, so operations on different shards
+// never wait for each other and lookups in the same shard run side by side.
+// Single-key operations lock one shard; size(), for_each() and snapshot()
+// take every shard's shared lock at once, always in index order, and see one
+// consistent state. No iterators are handed out, since they would outlive
+// the lock: lookups copy the mapped value out.
+template <typename Key, typename T, size_t Shards = 16,
+          typename Hash = std::hash<Key>, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<T>>
+class ShardedMap {
+  static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0,
+                "ShardedMap needs a power-of-two shard count");
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using hasher = Hash;
+  using key_compare = Compare;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using allocator_type = Alloc;
+  using size_type = size_t;
+  using shard_type = Tree<Key, T, Compare, Alloc>;
+  using snapshot_type = Map<Key, T, Compare, Alloc>;
+
+  ShardedMap() = default;
+
+  ShardedMap(std::initializer_list<value_type> const &items) {
+    for (auto i = items.begin(); i != items.end(); ++i) {
+      insert(*i);
+    }
+  }
+
+  ShardedMap(const ShardedMap &) = delete;
+  ShardedMap &operator=(const ShardedMap &) = delete;
+
+  static constexpr size_type shard_count() noexcept { return Shards; }
+
+  // copies the mapped value into out; false if key is absent
+  bool find(const key_type &key, mapped_type &out) const {
+    const Shard &shard = ShardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.cend()) {
+      return false;
+    }
+    out = (*it).second;
+    return true;
+  }
+
+  bool contains(const key_type &key) const {
+    const Shard &shard = ShardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.contains(key);
+  }
+
+  // false if key was already present; the map is left unchanged then
+  bool insert(const value_type &value) {
+    Shard &shard = ShardFor(value.first);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.insert(value).second;
+  }
+
+  bool insert(value_type &&value) {
+    Shard &shard = ShardFor(value.first);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.insert(std::move(value)).second;
+  }
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    Shard &shard = ShardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.insert(key, obj).second;
+  }
+
+  // true if key was inserted, false if an existing value was overwritten
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    Shard &shard = ShardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.insert_or_assign(key, obj).second;
+  }
+
+  bool insert_or_assign(const key_type &key, mapped_type &&obj) {
+    Shard &shard = ShardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tree.insert_or_assign(key, std::move(obj)).second;
+  }
+
+  // number of elements removed (0 or 1)
+  size_type erase(const key_type &key) {
+    Shard &shard = ShardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.tree.find(key);
+    if (it == shard.tree.end()) {
+      return 0;
+    }
+    shard.tree.erase(it);
+    return 1;
+  }
+
+  void clear() {
+    for (Shard &shard : shards_) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.tree.clear();
+    }
+  }
+
+  size_type size() const {
+    auto locks = LockAll();
+    size_type total = 0;
+    for (const Shard &shard : shards_) {
+      total += shard.tree.size();
+    }
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // Calls f(const shard_type &) for every shard under that shard's shared
+  // lock, one shard at a time: writers to the other shards keep going, so
+  // the shards are not seen at the same instant.
+  template <typename F>
+  void for_each_shard(F f) const {
+    for (const Shard &shard : shards_) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      f(shard.tree);
+    }
+  }
+
+  // Calls f(const value_type &) for every element with all shards locked,
+  // so it sees one consistent state; shard by shard, not in key order.
+  template <typename F>
+  void for_each(F f) const {
+    auto locks = LockAll();
+    for (const Shard &shard : shards_) {
+      for (auto it = shard.tree.cbegin(); it != shard.tree.cend(); ++it) {
+        f(*it);
+      }
+    }
+  }
+
+  // A sorted copy of one consistent state.
+  snapshot_type snapshot() const {
+    snapshot_type result;
+    for_each([&result](const value_type &value) { result.insert(value); });
+    return result;
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct alignas(kCacheLine) Shard {
+    mutable std::shared_mutex mutex;
+    shard_type tree;
+  };
+
+  // Fibonacci hashing: the high bits of hash * 2^64/phi pick the shard, so
+  // identity hashes of consecutive integers still spread over all shards.
+  static size_type ShardIndex(const key_type &key) {
+    if constexpr (Shards == 1) {
+      return 0;
+    } else {
+      uint64_t h = static_cast<uint64_t>(hasher()(key));
+      return static_cast<size_type>((h * 0x9E3779B97F4A7C15ull) >>
+                                    (64 - Log2(Shards)));
+    }
+  }
+
+  static constexpr int Log2(size_type n) {
+    int bits = 0;
+    while (n > 1) {
+      n >>= 1;
+      ++bits;
+    }
+    return bits;
+  }
+
+  Shard &ShardFor(const key_type &key) { return shards_[ShardIndex(key)]; }
+
+  const Shard &ShardFor(const key_type &key) const {
+    return shards_[ShardIndex(key)];
+  }
+
+  std::array<std::shared_lock<std::shared_mutex>, Shards> LockAll() const {
+    std::array<std::shared_lock<std::shared_mutex>, Shards> locks;
+    for (size_type i = 0; i < Shards; ++i) {
+      locks[i] = std::shared_lock<std::shared_mutex>(shards_[i].mutex);
+    }
+    return locks;
+  }
+
+  std::array<Shard, Shards> shards_;
+};
+
+};      // namespace s21
+#endif  //_SHARDED_MAP_H_
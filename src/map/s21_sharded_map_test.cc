@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(TestShardedMap, InsertFindErase) {
+  s21::ShardedMap<int, std::string, 4> m{{1, "one"}, {2, "two"}};
+  ASSERT_EQ(m.size(), 2u);
+  ASSERT_TRUE(m.insert(3, "three"));
+  ASSERT_FALSE(m.insert({3, "drei"}));
+  std::string out;
+  ASSERT_TRUE(m.find(3, out));
+  ASSERT_EQ(out, "three");
+  ASSERT_FALSE(m.find(4, out));
+  ASSERT_TRUE(m.contains(1));
+  ASSERT_EQ(m.erase(1), 1u);
+  ASSERT_EQ(m.erase(1), 0u);
+  ASSERT_FALSE(m.contains(1));
+  ASSERT_EQ(m.size(), 2u);
+  m.clear();
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(TestShardedMap, InsertOrAssign) {
+  s21::ShardedMap<int, std::string> m;
+  ASSERT_TRUE(m.insert_or_assign(5, "a"));
+  std::string b = "b";
+  ASSERT_FALSE(m.insert_or_assign(5, b));
+  ASSERT_FALSE(m.insert_or_assign(5, std::string("c")));
+  std::string out;
+  ASSERT_TRUE(m.find(5, out));
+  ASSERT_EQ(out, "c");
+  ASSERT_EQ(m.size(), 1u);
+}
+
+TEST(TestShardedMap, SpreadsOverShards) {
+  s21::ShardedMap<int, int, 8> m;
+  for (int i = 1; i <= 800; ++i) {
+    m.insert(i, i);
+  }
+  size_t total = 0;
+  m.for_each_shard([&total](const s21::ShardedMap<int, int, 8>::shard_type &t) {
+    ASSERT_GT(t.size(), 50u);
+    total += t.size();
+  });
+  ASSERT_EQ(total, 800u);
+}
+
+TEST(TestShardedMap, SnapshotIsSorted) {
+  s21::ShardedMap<int, int> m;
+  for (int i = 100; i >= 1; --i) {
+    m.insert(i, i * 2);
+  }
+  auto snap = m.snapshot();
+  ASSERT_EQ(snap.size(), 100u);
+  int expected = 1;
+  for (auto it = snap.begin(); it != snap.end(); ++it) {
+    ASSERT_EQ((*it).first, expected);
+    ASSERT_EQ((*it).second, expected * 2);
+    ++expected;
+  }
+  long long sum = 0;
+  m.for_each([&sum](const std::pair<const int, int> &v) { sum += v.first; });
+  ASSERT_EQ(sum, 5050);
+}
+
+// One writer inserts 1, 2, 3, ... in order. A snapshot taken with all
+// shards locked sees the map at one instant, so it always holds a prefix
+// 1..k; visiting shard by shard under separate locks could see k + 1 while
+// missing k.
+TEST(TestShardedMap, SnapshotIsConsistentUnderWrites) {
+  constexpr int kKeys = 20000;
+  s21::ShardedMap<int, int, 8> m;
+  std::thread writer([&m] {
+    for (int i = 1; i <= kKeys; ++i) {
+      m.insert(i, i);
+    }
+  });
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 2; ++t) {
+    readers.emplace_back([&m] {
+      for (int s = 0; s < 20; ++s) {
+        auto snap = m.snapshot();
+        int expected = 1;
+        for (auto it = snap.begin(); it != snap.end(); ++it) {
+          ASSERT_EQ((*it).first, expected);
+          ++expected;
+        }
+        int value = 0;
+        ASSERT_TRUE(snap.size() == 0 || m.find(1, value));
+      }
+    });
+  }
+  writer.join();
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  ASSERT_EQ(m.size(), static_cast<size_t>(kKeys));
+}
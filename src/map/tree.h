@@ -1,31 +1,52 @@
 #ifndef _TREE_H_
 #define _TREE_H_
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../allocator/s21_pool_allocator.h"
 
 namespace s21 {
 
-template <typename Key, typename T, bool IsConst>
+template <typename Key, typename T, bool IsConst,
+          typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<T>>
 class TreeCommonIterator;
 
 enum color_t { red, black };
 
+// Besides the tree links every node is threaded into a circular list in
+// key order: prev_ and next_ are its in-order neighbours, and the tree's fake
+// node closes the circle, so that it sits before the minimum and after the
+// maximum. Iterators only ever follow the thread.
 template <typename Key, typename T>
 class Node {
  public:
   using value_type = std::pair<const Key, T>;
-  value_type *data_;
+  value_type data_;
   color_t color_;
   Node *parent_;
   Node *left_;
   Node *right_;
-  Node(value_type *data, color_t color, Node *parent, Node *left, Node *right)
-      : data_(data),
-        color_(color),
-        parent_(parent),
-        left_(left),
-        right_(right) {}
+  Node *prev_;
+  Node *next_;
+  // black and unlinked, the value built in place from args
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : data_(std::forward<Args>(args)...),
+        color_(black),
+        parent_(nullptr),
+        left_(nullptr),
+        right_(nullptr),
+        prev_(nullptr),
+        next_(nullptr) {}
 };
 
 template <typename Key, typename T, typename Compare = std::less<Key>,
@@ -34,6 +55,7 @@ class Tree {
  public:
   using key_type = Key;
   using mapped_type = T;
+  using key_compare = Compare;
   using value_type = std::pair<const Key, T>;
   using reference = value_type &;
   using const_reference = const value_type &;
@@ -41,17 +63,35 @@ class Tree {
   using const_pointer = const value_type *;
   using NodeAlloc = typename std::allocator_traits<
       Alloc>::template rebind_alloc<Node<key_type, mapped_type>>;
-  using DataAlloc = typename std::allocator_traits<
-      Alloc>::template rebind_alloc<std::pair<const Key, T>>;
-  using iterator = TreeCommonIterator<key_type, mapped_type, false>;
-  using const_iterator = TreeCommonIterator<key_type, mapped_type, true>;
+  using allocator_type = Alloc;
+  using iterator =
+      TreeCommonIterator<key_type, mapped_type, false, Compare, Alloc>;
+  using const_iterator =
+      TreeCommonIterator<key_type, mapped_type, true, Compare, Alloc>;
   using size_type = size_t;
 
+  // The elements of [first, last) seen through two iterators; nothing is
+  // copied, and the elements are only visited as the caller advances.
+  template <typename Iterator>
+  class RangeView {
+   public:
+    RangeView(Iterator first, Iterator last) : first_(first), last_(last) {}
+
+    Iterator begin() const { return first_; }
+    Iterator end() const { return last_; }
+    bool empty() const { return first_ == last_; }
+
+   private:
+    Iterator first_;
+    Iterator last_;
+  };
+
+  using range_view = RangeView<iterator>;
+
   friend class Node<Key, T>;
 
   Tree()
-      : alloc_(),
-        alloc_node_(),
+      : alloc_node_(),
         compare_(),
         root_(nullptr),
         min_node_(nullptr),
@@ -60,8 +100,7 @@ class Tree {
         size_(0){};
 
   Tree(std::initializer_list<value_type> const &items)
-      : alloc_(),
-        alloc_node_(),
+      : alloc_node_(),
         compare_(),
         root_(nullptr),
         min_node_(nullptr),
@@ -74,9 +113,8 @@ class Tree {
   };
 
   Tree(const Tree &m)
-      : alloc_(),
-        alloc_node_(),
-        compare_(),
+      : alloc_node_(),
+        compare_(m.compare_),
         root_(nullptr),
         min_node_(nullptr),
         max_node_(nullptr),
@@ -85,14 +123,14 @@ class Tree {
     CopyElementsForTree(m);
   };
 
-  Tree(Tree &&m) : alloc_(), alloc_node_(), compare_() {
+  Tree(Tree &&m) : alloc_node_(), compare_(m.compare_) {
     MoveTree(std::move(m));
   };
 
   Tree &operator=(const Tree &m) {
     if (this != &m) {
       clear();
-      Tree<key_type, mapped_type> new_tree(m);
+      Tree new_tree(m);
       swap(new_tree);
     }
     return *this;
@@ -108,12 +146,10 @@ class Tree {
   };
 
   ~Tree() {
-    if (!empty()) {
-      if (fake_node_ != nullptr) {
-        DeleteFakeNode();
-      }
-      DeallocateDestroyTree(root_);
+    if (fake_node_ != nullptr) {
+      DeleteFakeNode();
     }
+    DeallocateDestroyTree(root_);
   };
 
   Node<key_type, mapped_type> *GetRoot() const noexcept { return root_; };
@@ -127,21 +163,20 @@ class Tree {
   }
 
   mapped_type &at(const key_type &key) const {
-    Node<key_type, mapped_type> *ptr = Search(root_, key);
+    Node<key_type, mapped_type> *ptr = Search(key);
     if (ptr == nullptr) {
       throw std::out_of_range("error");
     }
-    return ptr->data_->second;
+    return ptr->data_.second;
   };
 
   mapped_type &operator[](const key_type &key) {
-    Node<key_type, mapped_type> *ptr = Search(root_, key);
-    if (ptr == nullptr || !CheckFakeNode(ptr)) {
-      insert(std::make_pair(key, mapped_type()));
-      Node<key_type, mapped_type> *ptr = Search(root_, key);
-      return ptr->data_->second;
-    }
-    return ptr->data_->second;
+    return InsertUnique(key, [&] {
+             return AllocateNode(std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple());
+           })
+        .first->data_.second;
   };
 
   iterator begin() noexcept { return iterator(this, min_node_); };
@@ -171,67 +206,188 @@ class Tree {
   void clear() {
     if (fake_node_ != nullptr) {
       DeleteFakeNode();
+      fake_node_ = nullptr;
     }
     DeallocateDestroyTree(root_);
     root_ = nullptr;
     min_node_ = nullptr;
     max_node_ = nullptr;
     size_ = 0;
+    ReleaseNodes(alloc_node_);
   };
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    size_++;
-    bool result = true;
-    auto iter = begin();
-    if (empty()) {
-      root_ = AllocateNode(root_, value);
-      min_node_ = root_;
-      max_node_ = root_;
-      CreateFakeNode();
-      iter = begin();
-    } else {
-      Node<key_type, mapped_type> *child_node = InsertNotEmpty(value);
-      CheckTreeConditions(child_node);
-      UpdateParameter();
-      iter = begin();
-      iter = SearchIterator(child_node->data_->first);
-    }
-    if (iter == end()) {
-      result = false;
-      iter = end();
-    }
-    return std::make_pair(iter, result);
+    auto result = InsertUnique(value.first, [&] { return AllocateNode(value); });
+    return std::make_pair(iterator(this, result.first), result.second);
+  };
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    auto result = InsertUnique(
+        value.first, [&] { return AllocateNode(std::move(value)); });
+    return std::make_pair(iterator(this, result.first), result.second);
   };
 
   std::pair<iterator, bool> insert(const key_type &key,
                                    const mapped_type &obj) {
-    auto pair = insert(std::make_pair(key, obj));
-    return pair;
+    auto result = InsertUnique(key, [&] { return AllocateNode(key, obj); });
+    return std::make_pair(iterator(this, result.first), result.second);
   };
 
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj) {
-    Node<key_type, mapped_type> *ptr = Search(root_, key);
-    bool result = false;
-    if (ptr == nullptr || !CheckFakeNode(ptr)) {
-      insert(std::make_pair(key, obj));
-      result = true;
-    }
-    auto iter = SearchIterator(key);
-    return std::make_pair(iter, result);
+    auto result =
+        InsertUnique(key, [&] { return AllocateNode(key, obj); });
+    if (!result.second) {
+      result.first->data_.second = obj;
+    }
+    return std::make_pair(iterator(this, result.first), result.second);
+  };
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             mapped_type &&obj) {
+    auto result =
+        InsertUnique(key, [&] { return AllocateNode(key, std::move(obj)); });
+    if (!result.second) {
+      result.first->data_.second = std::move(obj);
+    }
+    return std::make_pair(iterator(this, result.first), result.second);
   };
 
+  // Builds the value in a new node first, since its key is only known once
+  // it exists; the node is dropped again if the key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    Node<key_type, mapped_type> *node =
+        AllocateNode(std::forward<Args>(args)...);
+    std::pair<Node<key_type, mapped_type> *, bool> result;
+    try {
+      result = InsertUnique(node->data_.first, [node] { return node; });
+    } catch (...) {
+      DeallocateDestroyNode(node);
+      throw;
+    }
+    if (!result.second) {
+      DeallocateDestroyNode(node);
+    }
+    return std::make_pair(iterator(this, result.first), result.second);
+  }
+
+  // Inserts [first, last). A range sorted by key that is at least an eighth
+  // of the tree is merged with it in O(size() + n); anything else goes
+  // through insert() one element at a time.
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      if (count >= size_ / kBulkInsertRatio &&
+          std::is_sorted(first, last, [this](const auto &a, const auto &b) {
+            return compare_(a.first, b.first);
+          })) {
+        InsertSorted(first, last);
+        return;
+      }
+    }
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Merges a range sorted by key into the tree in one pass: the existing
+  // nodes and the new ones are gathered in key order and relinked into a
+  // perfectly balanced tree, with no rotations. As with insert(), keys that
+  // are already present, and repeats within the range, are skipped. A range
+  // that is not sorted throws std::invalid_argument and leaves the tree as
+  // it was.
+  template <typename InputIt>
+  void InsertSorted(InputIt first, InputIt last) {
+    if (fake_node_ == nullptr) {
+      fake_node_ = AllocateFakeNode();
+    }
+    std::vector<Node<key_type, mapped_type> *> old;
+    old.reserve(size_);
+    for (auto *ptr = fake_node_->next_; ptr != fake_node_; ptr = ptr->next_) {
+      old.push_back(ptr);
+    }
+    std::vector<Node<key_type, mapped_type> *> nodes;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      nodes.reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+    size_type i = 0;
+    try {
+      for (; first != last; ++first) {
+        const auto &key = (*first).first;
+        while (i < old.size() && compare_(old[i]->data_.first, key)) {
+          nodes.push_back(old[i++]);
+        }
+        if (i < old.size() && !compare_(key, old[i]->data_.first)) {
+          continue;
+        }
+        if (!nodes.empty() && !compare_(nodes.back()->data_.first, key)) {
+          if (compare_(key, nodes.back()->data_.first)) {
+            throw std::invalid_argument("range is not sorted");
+          }
+          continue;
+        }
+        nodes.push_back(AllocateNode(*first));
+      }
+    } catch (...) {
+      // the new nodes are those missing from old; both are in key order
+      size_type j = 0;
+      for (Node<key_type, mapped_type> *node : nodes) {
+        if (j < old.size() && node == old[j]) {
+          ++j;
+        } else {
+          DeallocateDestroyNode(node);
+        }
+      }
+      throw;
+    }
+    nodes.insert(nodes.end(), old.begin() + i, old.end());
+    if (nodes.empty()) {
+      return;
+    }
+    root_ = LinkBalanced(nodes.data(), 0, nodes.size(), nullptr, 0,
+                         RedLevel(nodes.size()));
+    Node<key_type, mapped_type> *prev = fake_node_;
+    for (Node<key_type, mapped_type> *node : nodes) {
+      prev->next_ = node;
+      node->prev_ = prev;
+      prev = node;
+    }
+    prev->next_ = fake_node_;
+    fake_node_->prev_ = prev;
+    size_ = nodes.size();
+    UpdateParameter();
+  }
+
+  // The hint is accepted for interface compatibility and not used.
+  template <typename... Args>
+  iterator emplace_hint(iterator, Args &&...args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+
   void erase(iterator pos) {
-    Node<key_type, mapped_type> *ptr = Search(root_, (*pos).first);
-    if (ptr == nullptr) {
+    if (empty() || pos == end()) {
       return;
     }
+    Node<key_type, mapped_type> *ptr = pos.node_;
     auto color = ptr->color_;
     Node<key_type, mapped_type> *child;
     Node<key_type, mapped_type> *parent;
     Node<key_type, mapped_type> *min;
     if (ptr == root_ && size_ == 1) {
-      --size_;
+      // only this node goes back to the allocator; the fake node and the
+      // allocator's arena stay for the next insert, and only clear() hands
+      // the arena back in bulk
+      DeallocateDestroyNode(ptr);
+      root_ = nullptr;
+      fake_node_->prev_ = fake_node_;
+      fake_node_->next_ = fake_node_;
+      UpdateParameter();
+      size_ = 0;
       return;
     } else if (ptr->left_ == nullptr) {
       child = ptr->right_;
@@ -242,7 +398,8 @@ class Tree {
       parent = ptr->parent_;
       Transplant(ptr, child);
     } else {
-      min = MinNode(ptr->right_);
+      // with two children the successor is the minimum of the right subtree
+      min = ptr->next_;
       color = min->color_;
       child = min->right_;
       if (min->parent_ == ptr) {
@@ -258,19 +415,17 @@ class Tree {
       min->left_->parent_ = min;
       min->color_ = ptr->color_;
     }
+    ptr->prev_->next_ = ptr->next_;
+    ptr->next_->prev_ = ptr->prev_;
     DeallocateDestroyNode(ptr);
     if (color == black) {
       CheckTreeAfterDelete(child, parent);
     }
     UpdateParameter();
     --size_;
-    if (fake_node_ != nullptr) {
-      fake_node_->color_ = black;
-    }
   };
 
   void swap(Tree &other) {
-    std::swap(alloc_, other.alloc_);
     std::swap(alloc_node_, other.alloc_node_);
     std::swap(compare_, other.compare_);
     std::swap(root_, other.root_);
@@ -289,12 +444,75 @@ class Tree {
     }
   };
 
-  bool contains(const Key &key) const {
-    Node<key_type, mapped_type> *ptr = Search(root_, key);
-    if (ptr == nullptr) {
-      return false;
+  bool contains(const Key &key) const { return Search(key) != nullptr; }
+
+  // Heterogeneous lookup overloads exist only for comparators that declare
+  // is_transparent, as in std::map.
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return Search(key) != nullptr;
+  }
+
+  iterator find(const key_type &key) { return iterator(this, FindNode(key)); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(this, FindNode(key));
+  }
+
+  const_iterator find(const key_type &key) const {
+    return const_iterator(this, FindNode(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return const_iterator(this, FindNode(key));
+  }
+
+  // first element whose key is not less than key
+  iterator lower_bound(const key_type &key) {
+    return iterator(this, LowerBoundNode(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(this, LowerBoundNode(key));
+  }
+
+  // first element whose key is greater than key
+  iterator upper_bound(const key_type &key) {
+    return iterator(this, UpperBoundNode(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return iterator(this, UpperBoundNode(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return std::make_pair(iterator(this, LowerBoundNode(key)),
+                          iterator(this, UpperBoundNode(key)));
+  }
+
+  // Elements with lo <= key < hi, found with two descents in O(log n);
+  // empty unless lo < hi.
+  range_view range(const key_type &lo, const key_type &hi) {
+    iterator first = lower_bound(lo);
+    if (!compare_(lo, hi)) {
+      return range_view(first, first);
     }
-    return true;
+    return range_view(first, lower_bound(hi));
   }
 
   void CopyElementsForTree(const Tree &m) {
@@ -308,7 +526,11 @@ class Tree {
     }
   }
 
+  // Takes over m's nodes together with the allocator that owns them and
+  // the comparator that ordered them.
   void MoveTree(Tree &&m) {
+    std::swap(alloc_node_, m.alloc_node_);
+    compare_ = m.compare_;
     root_ = m.root_;
     min_node_ = m.min_node_;
     max_node_ = m.max_node_;
@@ -317,32 +539,14 @@ class Tree {
     m.root_ = nullptr;
     m.min_node_ = nullptr;
     m.max_node_ = nullptr;
+    m.fake_node_ = nullptr;
     m.size_ = 0;
   }
 
-  Node<key_type, mapped_type> *MinNode(Node<key_type, mapped_type> *ptr) const {
-    if (ptr->left_ == nullptr || !CheckFakeNode(ptr->left_)) {
-      return ptr;
-    }
-    return MinNode(ptr->left_);
-  }
-
-  Node<key_type, mapped_type> *MaxNode(Node<key_type, mapped_type> *ptr) const {
-    if (ptr->right_ == nullptr || (!CheckFakeNode(ptr->right_))) {
-      return ptr;
-    }
-    return MaxNode(ptr->right_);
-  }
-
-  bool CheckFakeNode(Node<key_type, mapped_type> *ptr) const {
-    if (ptr != fake_node_) {
-      return true;
-    }
-    return false;
-  }
-
  private:
-  DataAlloc alloc_;
+  // insert(first, last) merges the range if it holds at least size_ / 8
+  static constexpr size_type kBulkInsertRatio = 8;
+
   NodeAlloc alloc_node_;
   Compare compare_;
   Node<key_type, mapped_type> *root_;
@@ -351,54 +555,92 @@ class Tree {
   Node<key_type, mapped_type> *fake_node_;
   size_t size_;
 
-  Node<key_type, mapped_type> *Search(Node<key_type, mapped_type> *ptr,
-                                      key_type key) const {
-    if (!CheckFakeNode(ptr)) {
-      return nullptr;
-    }
-    if (ptr == nullptr || key == ptr->data_->first) {
-      return ptr;
+  // Node holding key, or nullptr. K is key_type or, with a transparent
+  // comparator, anything compare_ accepts against it.
+  template <typename K>
+  Node<key_type, mapped_type> *Search(const K &key) const {
+    Node<key_type, mapped_type> *ptr = root_;
+    while (ptr != nullptr) {
+      if (compare_(key, ptr->data_.first)) {
+        ptr = ptr->left_;
+      } else if (compare_(ptr->data_.first, key)) {
+        ptr = ptr->right_;
+      } else {
+        return ptr;
+      }
     }
-    if (std::less<Key>{}(key, ptr->data_->first)) {
-      return Search(ptr->left_, key);
-    } else {
-      return Search(ptr->right_, key);
+    return nullptr;
+  }
+
+  template <typename K>
+  Node<key_type, mapped_type> *FindNode(const K &key) const {
+    Node<key_type, mapped_type> *ptr = Search(key);
+    return ptr == nullptr ? fake_node_ : ptr;
+  }
+
+  template <typename K>
+  Node<key_type, mapped_type> *LowerBoundNode(const K &key) const {
+    Node<key_type, mapped_type> *ptr = root_;
+    Node<key_type, mapped_type> *result = fake_node_;
+    while (ptr != nullptr) {
+      if (compare_(ptr->data_.first, key)) {
+        ptr = ptr->right_;
+      } else {
+        result = ptr;
+        ptr = ptr->left_;
+      }
     }
+    return result;
   }
 
-  iterator SearchIterator(key_type key) {
-    auto iter = begin();
-    for (size_t i = 0; i < size_; ++i) {
-      if (iter == end()) {
-        break;
+  template <typename K>
+  Node<key_type, mapped_type> *UpperBoundNode(const K &key) const {
+    Node<key_type, mapped_type> *ptr = root_;
+    Node<key_type, mapped_type> *result = fake_node_;
+    while (ptr != nullptr) {
+      if (compare_(key, ptr->data_.first)) {
+        result = ptr;
+        ptr = ptr->left_;
+      } else {
+        ptr = ptr->right_;
       }
-      if ((*iter).first == key) {
-        return iter;
+    }
+    return result;
+  }
+
+  // Returns the node holding key and whether it was just created. make()
+  // returns the new, unlinked node and is only called when key is absent;
+  // nothing after it can throw.
+  template <typename K, typename Make>
+  std::pair<Node<key_type, mapped_type> *, bool> InsertUnique(const K &key,
+                                                              Make make) {
+    if (empty()) {
+      if (fake_node_ == nullptr) {
+        fake_node_ = AllocateFakeNode();
       }
-      ++iter;
+      root_ = make();
+      LinkBefore(root_, fake_node_);
+      UpdateParameter();
+      ++size_;
+      return std::make_pair(root_, true);
     }
-    return iter;
+    auto result = InsertNotEmpty(key, make);
+    if (result.second) {
+      CheckTreeConditions(result.first);
+      UpdateParameter();
+      ++size_;
+    }
+    return result;
   }
 
-  Node<key_type, mapped_type> *AllocateNode(Node<key_type, mapped_type> *ptr,
-                                            const value_type &value) {
-    ptr = std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
+  // Node and value share one block from alloc_node_.
+  template <typename... Args>
+  Node<key_type, mapped_type> *AllocateNode(Args &&...args) {
+    Node<key_type, mapped_type> *ptr =
+        std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
     try {
-      ptr->data_ = std::allocator_traits<DataAlloc>::allocate(alloc_, 1);
-      std::allocator_traits<NodeAlloc>::construct(
-          alloc_node_, std::addressof(ptr->color_), black);
-      std::allocator_traits<DataAlloc>::construct(
-          alloc_, std::addressof(ptr->data_->first),
-          std::move_if_noexcept(value.first));
-      std::allocator_traits<DataAlloc>::construct(
-          alloc_, std::addressof(ptr->data_->second),
-          std::move_if_noexcept(value.second));
-      std::allocator_traits<NodeAlloc>::construct(
-          alloc_node_, std::addressof(ptr->right_), nullptr);
       std::allocator_traits<NodeAlloc>::construct(
-          alloc_node_, std::addressof(ptr->left_), nullptr);
-      std::allocator_traits<NodeAlloc>::construct(
-          alloc_node_, std::addressof(ptr->parent_), nullptr);
+          alloc_node_, ptr, std::in_place, std::forward<Args>(args)...);
     } catch (...) {
       std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, ptr, 1);
       throw;
@@ -406,8 +648,25 @@ class Tree {
     return ptr;
   }
 
+  // the fake node of an empty tree is both its own predecessor and successor
+  Node<key_type, mapped_type> *AllocateFakeNode() {
+    Node<key_type, mapped_type> *ptr = AllocateNode();
+    ptr->prev_ = ptr;
+    ptr->next_ = ptr;
+    return ptr;
+  }
+
+  // threads node into the list just before next
+  static void LinkBefore(Node<key_type, mapped_type> *node,
+                         Node<key_type, mapped_type> *next) {
+    node->prev_ = next->prev_;
+    node->next_ = next;
+    next->prev_->next_ = node;
+    next->prev_ = node;
+  }
+
   void DeallocateDestroyTree(Node<key_type, mapped_type> *ptr) {
-    if (ptr == nullptr || !CheckFakeNode(ptr)) {
+    if (ptr == nullptr) {
       return;
     }
     if (ptr->left_ != nullptr) {
@@ -424,67 +683,82 @@ class Tree {
     ptr->right_ = nullptr;
     ptr->left_ = nullptr;
     ptr->parent_ = nullptr;
-    std::allocator_traits<DataAlloc>::destroy(alloc_, ptr->data_);
-    std::allocator_traits<DataAlloc>::deallocate(alloc_, ptr->data_, 1);
     std::allocator_traits<NodeAlloc>::destroy(alloc_node_, ptr);
     std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, ptr, 1);
     ptr = nullptr;
   }
 
-  void CreateFakeNode() {
-    fake_node_ = AllocateNode(fake_node_, value_type());
-    if (max_node_ != nullptr) {
-      max_node_->right_ = fake_node_;
-    }
-  }
-
   void DeleteFakeNode() {
-    max_node_->right_ = nullptr;
-    fake_node_->right_ = nullptr;
-    std::allocator_traits<DataAlloc>::destroy(alloc_, fake_node_->data_);
-    std::allocator_traits<DataAlloc>::deallocate(alloc_, fake_node_->data_, 1);
     std::allocator_traits<NodeAlloc>::destroy(alloc_node_, fake_node_);
     std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, fake_node_, 1);
   }
 
-  Node<key_type, mapped_type> *InsertNotEmpty(const value_type &value) {
+  // Links a new red leaf from make(), or returns the node that already holds
+  // key without touching the tree.
+  template <typename K, typename Make>
+  std::pair<Node<key_type, mapped_type> *, bool> InsertNotEmpty(const K &key,
+                                                                Make &make) {
     auto last_node = root_;
     Node<key_type, mapped_type> *parent_node = nullptr;
-    Node<key_type, mapped_type> *child_node = nullptr;
-    child_node = AllocateNode(child_node, value);
-    child_node->color_ = red;
-    while (last_node != nullptr && CheckFakeNode(last_node)) {
+    bool to_right = false;
+    while (last_node != nullptr) {
       parent_node = last_node;
-      if (std::less<key_type>{}(last_node->data_->first,
-                                child_node->data_->first)) {
+      if (compare_(key, last_node->data_.first)) {
+        to_right = false;
+        last_node = last_node->left_;
+      } else if (compare_(last_node->data_.first, key)) {
+        to_right = true;
         last_node = last_node->right_;
       } else {
-        last_node = last_node->left_;
+        return std::make_pair(last_node, false);
       }
     }
+    Node<key_type, mapped_type> *child_node = make();
+    child_node->color_ = red;
     child_node->parent_ = parent_node;
-    if (std::less<key_type>{}(parent_node->data_->first,
-                              child_node->data_->first)) {
+    // a right child comes straight after its parent, a left one before it
+    if (to_right) {
       parent_node->right_ = child_node;
+      LinkBefore(child_node, parent_node->next_);
     } else {
       parent_node->left_ = child_node;
+      LinkBefore(child_node, parent_node);
     }
-    if (!CheckFakeNode(max_node_->right_)) {
-      max_node_->right_ = nullptr;
-    }
-    return child_node;
+    return std::make_pair(child_node, true);
   }
 
-  void UpdateParameter() {
-    max_node_ = MaxNode(root_);
-    min_node_ = MinNode(root_);
-    if (max_node_ != nullptr) {
-      max_node_->right_ = fake_node_;
-      fake_node_->parent_ = max_node_;
+  // Depth of the partly filled bottom level of a tree of n nodes built by
+  // LinkBalanced (computeRedLevel of java.util.TreeMap).
+  static int RedLevel(size_type n) {
+    int level = 0;
+    for (long long m = static_cast<long long>(n) - 1; m >= 0; m = m / 2 - 1) {
+      ++level;
     }
-    if (min_node_ != nullptr && fake_node_ != nullptr) {
-      fake_node_->right_ = min_node_;
+    return level;
+  }
+
+  // Links nodes[lo, hi) into a balanced subtree rooted at the middle node.
+  // The levels above red_level are full and black and the partly filled
+  // bottom level is red, so every path has the same number of black nodes
+  // and no red node has a red child.
+  static Node<key_type, mapped_type> *LinkBalanced(
+      Node<key_type, mapped_type> **nodes, size_type lo, size_type hi,
+      Node<key_type, mapped_type> *parent, int level, int red_level) {
+    if (lo >= hi) {
+      return nullptr;
     }
+    size_type mid = lo + (hi - lo - 1) / 2;
+    Node<key_type, mapped_type> *node = nodes[mid];
+    node->parent_ = parent;
+    node->color_ = level == red_level ? red : black;
+    node->left_ = LinkBalanced(nodes, lo, mid, node, level + 1, red_level);
+    node->right_ = LinkBalanced(nodes, mid + 1, hi, node, level + 1, red_level);
+    return node;
+  }
+
+  void UpdateParameter() {
+    min_node_ = fake_node_->next_;
+    max_node_ = fake_node_->prev_;
   }
 
   void RotateLeft(Node<key_type, mapped_type> *ptr) {
@@ -572,7 +846,6 @@ class Tree {
       }
     }
     root_->color_ = black;
-    fake_node_->color_ = black;
   };
 
   void Transplant(Node<key_type, mapped_type> *ptr,
@@ -661,10 +934,11 @@ class Tree {
   }
 };
 
-template <typename Key, typename T, bool IsConst>
+template <typename Key, typename T, bool IsConst, typename Compare,
+          typename Alloc>
 class TreeCommonIterator {
  public:
-  friend class Tree<Key, T>;
+  friend class Tree<Key, T, Compare, Alloc>;
   friend class Node<Key, T>;
   using key_type = Key;
   using mapped_type = T;
@@ -680,7 +954,7 @@ class TreeCommonIterator {
   using conditional_node_ref =
       std::conditional_t<IsConst, const_reference, reference>;
 
-  using tree_type = Tree<key_type, mapped_type>;
+  using tree_type = Tree<key_type, mapped_type, Compare, Alloc>;
   using tree_reference = tree_type &;
   using const_tree_reference = const tree_type &;
   using tree_pointer = tree_type *;
@@ -695,8 +969,13 @@ class TreeCommonIterator {
   TreeCommonIterator(conditional_tree_ptr tree, conditional_node_ptr node)
       : tree_(tree), node_(node){};
 
-  value_type &operator*() const { return *(node_->data_); }
-  value_type operator->() const { return node_->data_; }
+  using value_reference =
+      std::conditional_t<IsConst, const value_type &, value_type &>;
+  using value_pointer =
+      std::conditional_t<IsConst, const value_type *, value_type *>;
+
+  value_reference operator*() const { return node_->data_; }
+  value_pointer operator->() const { return &node_->data_; }
 
   TreeCommonIterator &operator++() {
     node_ = NextNode();
@@ -718,60 +997,21 @@ class TreeCommonIterator {
     return *this;
   };
 
-  bool operator==(const TreeCommonIterator &other) {
+  bool operator==(const TreeCommonIterator &other) const {
     return node_ == other.node_;
   };
 
-  bool operator!=(const TreeCommonIterator &other) {
-    return node_->data_->first != other.node_->data_->first;
+  bool operator!=(const TreeCommonIterator &other) const {
+    return node_ != other.node_;
   };
 
  private:
   conditional_tree_ptr tree_;
   conditional_node_ptr node_;
 
-  conditional_node_ptr TraversalTree() const {
-    if (node_ == tree_->GetFakeNode()) {
-      return tree_->GetMax();
-    } else if (node_->right_ != nullptr) {
-      return tree_->MinNode(node_->right_);
-    } else if (node_->parent_ == nullptr) {
-      return tree_->GetFakeNode();
-    } else if (node_ == node_->parent_->left_) {
-      return node_->parent_;
-    } else {
-      Node<key_type, mapped_type> *x = node_->parent_;
-      while (x == node_->parent_->right_) {
-        x = x->parent_;
-      }
-      return x->parent_;
-    }
-    return node_;
-  }
-
-  conditional_node_ptr ReverseTraversalTree() const {
-    if (tree_->size() == 1) {
-      return tree_->GetRoot();
-    } else if (node_->left_ != nullptr) {
-      return tree_->MaxNode(node_->left_);
-    } else if (node_->parent_ != nullptr && node_ == node_->parent_->right_) {
-      return node_->parent_;
-    }
-    if (node_ == tree_->GetMin()) {
-      return tree_->GetFakeNode();
-    } else {
-      Node<key_type, mapped_type> *x = node_->parent_;
-      while (node_->parent_ != nullptr && x == node_->parent_->left_) {
-        x = x->parent_;
-      }
-      return x->parent_;
-    }
-    return node_;
-  }
-
-  conditional_node_ptr NextNode() const { return TraversalTree(); }
+  conditional_node_ptr NextNode() const { return node_->next_; }
 
-  conditional_node_ptr PreviousNode() const { return ReverseTraversalTree(); }
+  conditional_node_ptr PreviousNode() const { return node_->prev_; }
 };
 };      // namespace s21
 #endif  //_TREE_H_
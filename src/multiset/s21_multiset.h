@@ -5,37 +5,67 @@
 
 namespace s21 {
 
-template <class Key>
-class Multiset : public MRBTree<Key, Key> {
+template <class Key, class Alloc = std::allocator<Key>>
+class Multiset : public MRBTree<Key, Key, Alloc> {
  public:
   using value_type = Key;
   using key_type = Key;
   using reference = Key &;
   using const_reference = const Key &;
-  using iterator = typename MRBTree<Key, Key>::iterator;
-  using const_iterator = typename MRBTree<Key, Key>::const_iterator;
+  using iterator = typename MRBTree<Key, Key, Alloc>::iterator;
+  using const_iterator = typename MRBTree<Key, Key, Alloc>::const_iterator;
   using size_type = size_t;
+  using allocator_type = Alloc;
   using multiset = Multiset;
 
  public:
-  Multiset() : MRBTree<Key, Key>() {}
+  Multiset() : MRBTree<Key, Key, Alloc>() {}
   Multiset(std::initializer_list<value_type> const &items)
-      : MRBTree<Key, Key>(items) {}
-  Multiset(const Multiset &other) : MRBTree<Key, Key>(other) {}
-  Multiset(Multiset &&multiset) : MRBTree<Key, Key>(std::move(multiset)) {}
+      : MRBTree<Key, Key, Alloc>(items) {}
+  Multiset(const Multiset &other) : MRBTree<Key, Key, Alloc>(other) {}
+  Multiset(Multiset &&multiset)
+      : MRBTree<Key, Key, Alloc>(std::move(multiset)) {}
   // Оператор перемещающего присвоения
   Multiset &operator=(Multiset &&multiset) {
     if (this != &multiset) {
       // Вызываем оператор перемещающего присвоения базового класса
-      MRBTree<Key, Key>::operator=(std::move(multiset));
+      MRBTree<Key, Key, Alloc>::operator=(std::move(multiset));
     }
     return *this;
   }
   ~Multiset() = default;
 
-  void insert(const key_type &key) {
+  iterator insert(const key_type &key) {
     // Вызываем метод вставки дерева, передавая ключ как и данные
-    MRBTree<Key, Key>::insert(key, key);
+    return MRBTree<Key, Key, Alloc>::insert(key, key);
+  }
+
+  // Ключом узла служит само значение: value ищется по месту и затем
+  // перемещается в узел целиком, без копии ключа
+  iterator insert(value_type &&value) {
+    return MRBTree<Key, Key, Alloc>::insert(value, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(Args &&...args) {
+    // Значение строится прямо в узле, без временного value_type
+    return MRBTree<Key, Key, Alloc>::emplace(std::forward<Args>(args)...);
+  }
+
+  // Отсортированный диапазон сливается с деревом за линейное время
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    MRBTree<Key, Key, Alloc>::insertRange(first, last);
+  }
+
+  // Строит сбалансированное дерево из отсортированного диапазона за O(n);
+  // неотсортированный диапазон - std::invalid_argument
+  template <typename InputIt>
+  static Multiset from_sorted(InputIt first, InputIt last) {
+    Multiset result;
+    result.insertSorted(first, last);
+    return result;
   }
 };
 
@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <random>
 #include <set>
+#include <stdexcept>
+#include <vector>
 
 #include "../s21_containersplus.h"
 
@@ -32,7 +37,7 @@ TEST(MRBTreeTest, Search) {
   auto foundNode = myTree.find(2);
 
   EXPECT_NE(foundNode, nullptr);  // Узел должен быть найден
-  EXPECT_EQ(foundNode->key_, 2);
+  EXPECT_EQ(foundNode->key(), 2);
 }
 
 TEST(MRBTreeTest, erase2) {
@@ -665,3 +670,215 @@ TEST(MultisetComparisonTest2, Merge) {
   EXPECT_TRUE(
       std::equal(myMultiset.begin(), myMultiset.end(), stdMultiset.begin()));
 }
+
+// Вставка и удаление в перемешанном порядке сохраняют балансировку дерева
+TEST(MultisetComparisonTest2, InsertEraseShuffled) {
+  s21::Multiset<int> myMultiset;
+  std::multiset<int> stdMultiset;
+  for (int i = 0; i < 500; ++i) {
+    myMultiset.insert((i * 37) % 500);
+    stdMultiset.insert((i * 37) % 500);
+  }
+  EXPECT_TRUE(std::equal(myMultiset.begin(), myMultiset.end(), stdMultiset.begin()));
+  for (int i = 0; i < 500; i += 2) {
+    myMultiset.erase((i * 91) % 500);
+    stdMultiset.erase((i * 91) % 500);
+  }
+  EXPECT_EQ(myMultiset.size(), stdMultiset.size());
+  EXPECT_TRUE(std::equal(myMultiset.begin(), myMultiset.end(), stdMultiset.begin()));
+}
+
+TEST(MultisetEmplaceTest, EmplaceInPlace) {
+  s21::Multiset<std::string> myMultiset;
+  auto it = myMultiset.emplace(3, 'b');
+  EXPECT_EQ(*it, "bbb");
+  myMultiset.emplace("bbb");
+  myMultiset.insert(std::string("a"));
+  EXPECT_EQ(myMultiset.count("bbb"), 2u);
+  EXPECT_EQ(myMultiset.size(), 3u);
+  EXPECT_EQ(*myMultiset.begin(), "a");
+}
+
+// Черная высота поддерева; -1, если нарушены свойства красно-черного дерева,
+// порядок ключей или ссылки на родителя
+template <typename Node, typename Color>
+int CheckMultiRedBlack(const Node *node, const Node *parent, Color red) {
+  if (node == nullptr) {
+    return 1;
+  }
+  if (node->parent_ != parent) {
+    return -1;
+  }
+  if (node->left_ != nullptr && node->key() < node->left_->key()) {
+    return -1;
+  }
+  if (node->right_ != nullptr && node->right_->key() < node->key()) {
+    return -1;
+  }
+  if (node->color_ == red &&
+      ((node->left_ != nullptr && node->left_->color_ == red) ||
+       (node->right_ != nullptr && node->right_->color_ == red))) {
+    return -1;
+  }
+  int left = CheckMultiRedBlack(node->left_, node, red);
+  int right = CheckMultiRedBlack(node->right_, node, red);
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  return left + (node->color_ == red ? 0 : 1);
+}
+
+TEST(MultisetTest, FromSortedKeepsRepeats) {
+  std::vector<int> items;
+  for (int i = 0; i < 500; ++i) {
+    items.push_back(i / 3);
+  }
+  auto ms = s21::Multiset<int>::from_sorted(items.begin(), items.end());
+  ASSERT_EQ(ms.size(), 500u);
+  ASSERT_GT(CheckMultiRedBlack(ms.get_root(),
+                               decltype(ms.get_root())(nullptr),
+                               s21::Multiset<int>::Color::RED),
+            0);
+  ASSERT_TRUE(std::equal(ms.begin(), ms.end(), items.begin()));
+  ASSERT_EQ(ms.count(10), 3u);
+}
+
+TEST(MultisetTest, RangeInsertMergesSortedRange) {
+  s21::Multiset<int> ms{2, 2, 4};
+  std::vector<int> sorted{1, 2, 3, 4, 5};
+  ms.insert(sorted.begin(), sorted.end());
+  ASSERT_EQ(ms.size(), 8u);
+  ASSERT_GT(CheckMultiRedBlack(ms.get_root(),
+                               decltype(ms.get_root())(nullptr),
+                               s21::Multiset<int>::Color::RED),
+            0);
+  std::vector<int> expected{1, 2, 2, 2, 3, 4, 4, 5};
+  ASSERT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin()));
+  std::vector<int> unsorted{3, 1};
+  ASSERT_THROW(s21::Multiset<int>::from_sorted(unsorted.begin(),
+                                               unsorted.end()),
+               std::invalid_argument);
+}
+
+// Размеры поддеревьев совпадают с фактическим числом узлов
+template <typename Node>
+size_t CheckSubtreeSizes(const Node *node, bool &ok) {
+  if (node == nullptr) {
+    return 0;
+  }
+  size_t size = CheckSubtreeSizes(node->left_, ok) +
+                CheckSubtreeSizes(node->right_, ok) + 1;
+  if (node->count_ != size) {
+    ok = false;
+  }
+  return size;
+}
+
+TEST(MultisetTest, OrderStatisticsMatchStdMultiset) {
+  s21::Multiset<int> ms;
+  std::multiset<int> expected;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 200);
+  for (int step = 0; step < 3000; ++step) {
+    int k = key(gen);
+    if (step % 3 == 2) {
+      ms.erase(k);
+      expected.erase(k);
+    } else {
+      ms.insert(k);
+      expected.insert(k);
+    }
+    if (step % 100 == 0) {
+      bool ok = true;
+      ASSERT_EQ(CheckSubtreeSizes(ms.get_root(), ok), expected.size());
+      ASSERT_TRUE(ok);
+    }
+  }
+  for (int k = -1; k <= 201; ++k) {
+    ASSERT_EQ(ms.count(k), expected.count(k));
+    size_t less = static_cast<size_t>(
+        std::distance(expected.begin(), expected.lower_bound(k)));
+    ASSERT_EQ(ms.rank(k), less);
+    ASSERT_EQ(ms.distance(ms.lower_bound(k), ms.upper_bound(k)),
+              expected.count(k));
+  }
+  size_t i = 0;
+  for (int value : expected) {
+    ASSERT_EQ(*ms.select(i), value);
+    ASSERT_EQ(ms.index_of(ms.nth(i)), i);
+    ++i;
+  }
+  ASSERT_TRUE(ms.select(expected.size()) == ms.end());
+  ASSERT_EQ(ms.index_of(ms.end()), ms.size());
+}
+
+TEST(MultisetTest, OrderStatisticsSurviveCopyAndBulkBuild) {
+  std::vector<int> items{1, 1, 2, 3, 3, 3, 5, 8};
+  auto ms = s21::Multiset<int>::from_sorted(items.begin(), items.end());
+  s21::Multiset<int> copy(ms);
+  bool ok = true;
+  ASSERT_EQ(CheckSubtreeSizes(copy.get_root(), ok), items.size());
+  ASSERT_TRUE(ok);
+  ASSERT_EQ(copy.count(3), 3u);
+  ASSERT_EQ(copy.rank(5), 6u);
+  ASSERT_EQ(*copy.nth(7), 8);
+  copy.erase(3);
+  ASSERT_EQ(copy.count(3), 0u);
+  ASSERT_EQ(*copy.nth(3), 5);
+  ASSERT_EQ(ms.count(3), 3u);
+}
+
+TEST(MultisetTest, EqualRangeOfLargestKeyAndRangeView) {
+  s21::Multiset<int> ms{1, 2, 2, 5, 5, 5};
+  auto last = ms.equal_range(5);
+  ASSERT_EQ(ms.distance(last.first, last.second), 3u);
+  ASSERT_TRUE(last.second == ms.end());
+  auto missing = ms.equal_range(3);
+  ASSERT_TRUE(missing.first == missing.second);
+  ASSERT_EQ(*missing.first, 5);
+  std::vector<int> seen;
+  for (int value : ms.range(2, 5)) {
+    seen.push_back(value);
+  }
+  ASSERT_EQ(seen, (std::vector<int>{2, 2}));
+  ASSERT_TRUE(ms.range(5, 2).empty());
+}
+
+// Значение без копирования строится прямо в узле
+TEST(MultisetTest, EmplaceMoveOnlyValue) {
+  s21::Multiset<std::unique_ptr<int>> set;
+  for (int i = 0; i < 10; ++i) {
+    set.emplace(std::make_unique<int>(7));
+  }
+  auto moved = std::make_unique<int>(8);
+  set.insert(std::move(moved));
+  ASSERT_EQ(moved, nullptr);
+  ASSERT_EQ(set.size(), 11u);
+  for (const auto &value : set) {
+    ASSERT_TRUE(*value == 7 || *value == 8);
+  }
+}
+
+// Удаление узла с двумя детьми переставляет преемника, а не копирует его
+// значение: остальные элементы остаются на своих местах
+TEST(MultisetTest, EraseKeepsOtherNodesInPlace) {
+  s21::Multiset<int> set;
+  std::vector<const int *> address(100);
+  for (int i = 0; i < 100; ++i) {
+    set.insert(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    address[i] = &*set.lower_bound(i);
+  }
+  for (int i = 0; i < 100; i += 3) {
+    set.erase(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_FALSE(set.contains(i));
+    } else {
+      ASSERT_EQ(&*set.lower_bound(i), address[i]);
+    }
+  }
+  ASSERT_EQ(set.size(), 66u);
+}
@@ -0,0 +1,197 @@
+#ifndef s21_mpmc_queue_h
+#define s21_mpmc_queue_h
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Bounded lock-free FIFO for any number of producer and consumer threads
+// (D. Vyukov's bounded MPMC queue). Every cell carries a sequence number that
+// says whose turn it is: a cell at position pos is free for the producer that
+// claims pos while sequence == pos, and holds a value for the consumer that
+// claims pos while sequence == pos + 1. Producers and consumers claim
+// positions with a CAS on their own counter and hand the cell over with a
+// release store of the next sequence, so the only contended words are the two
+// counters. Moves of T must not throw: a claimed cell cannot be given back,
+// and a consumer that left it without publishing the next sequence would
+// stall every producer that reaches it.
+template <typename T, typename Alloc = std::allocator<T>>
+class MpmcQueue {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "MpmcQueue needs a noexcept move constructor");
+  static_assert(std::is_nothrow_move_assignable_v<T>,
+                "MpmcQueue needs a noexcept move assignment, Pop assigns out");
+
+ public:
+  using value_type = typename Queue<T, Alloc>::value_type;
+  using reference = typename Queue<T, Alloc>::reference;
+  using const_reference = typename Queue<T, Alloc>::const_reference;
+  using size_type = typename Queue<T, Alloc>::size_type;
+  using allocator_type = typename Queue<T, Alloc>::allocator_type;
+
+  // capacity is rounded up to a power of two, at least 2
+  explicit MpmcQueue(size_type capacity)
+      : enqueue_pos_(0),
+        dequeue_pos_(0),
+        alloc_(),
+        mask_(RoundUp(capacity) - 1),
+        cells_(std::allocator_traits<CellAlloc>::allocate(alloc_, mask_ + 1)) {
+    for (size_type i = 0; i <= mask_; ++i) {
+      std::allocator_traits<CellAlloc>::construct(alloc_, cells_ + i, i);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  ~MpmcQueue() {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+    for (; pos != end; ++pos) {
+      cells_[pos & mask_].Value()->~value_type();
+    }
+    for (size_type i = 0; i <= mask_; ++i) {
+      std::allocator_traits<CellAlloc>::destroy(alloc_, cells_ + i);
+    }
+    std::allocator_traits<CellAlloc>::deallocate(alloc_, cells_, mask_ + 1);
+  }
+
+  // blocking: waits while the queue is full
+  void push(const_reference value) { emplace(value); }
+
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    Emplace(true, std::forward<Args>(args)...);
+  }
+
+  // non-blocking: returns false if the queue is full
+  bool try_push(const_reference value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    return Emplace(false, std::forward<Args>(args)...);
+  }
+
+  // blocking: waits for an element and moves it into out
+  void pop(reference out) { Pop(true, out); }
+
+  // non-blocking: returns false if the queue is empty
+  bool try_pop(reference out) { return Pop(false, out); }
+
+  // a snapshot; may be stale as soon as it is returned
+  size_type size_approx() const noexcept {
+    size_type head = dequeue_pos_.load(std::memory_order_acquire);
+    size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  bool empty() const noexcept { return size_approx() == 0; }
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct Cell {
+    explicit Cell(size_type seq) : sequence(seq) {}
+
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  using CellAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Cell>;
+
+  static size_type RoundUp(size_type n) {
+    size_type cap = 2;
+    while (cap < n) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  // A constructor that may throw runs before a cell is claimed; the value is
+  // then moved in, which cannot throw.
+  template <typename... Args>
+  bool Emplace(bool wait, Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<value_type, Args &&...>) {
+      value_type value(std::forward<Args>(args)...);
+      return Emplace(wait, std::move(value));
+    } else {
+      size_type pos;
+      Cell *cell = Claim(enqueue_pos_, 0, wait, pos);
+      if (cell == nullptr) {
+        return false;
+      }
+      ::new (static_cast<void *>(cell->storage))
+          value_type(std::forward<Args>(args)...);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+  }
+
+  bool Pop(bool wait, reference out) {
+    size_type pos;
+    Cell *cell = Claim(dequeue_pos_, 1, wait, pos);
+    if (cell == nullptr) {
+      return false;
+    }
+    value_type *value = cell->Value();
+    out = std::move(*value);
+    value->~value_type();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Claims the next position of counter whose cell has sequence pos + lag.
+  // A sequence behind that means the ring is full (producers) or empty
+  // (consumers): return nullptr, or yield and retry when waiting.
+  Cell *Claim(std::atomic<size_type> &counter, size_type lag, bool wait,
+              size_type &pos) {
+    pos = counter.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell *cell = cells_ + (pos & mask_);
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + lag);
+      if (diff == 0) {
+        if (counter.compare_exchange_weak(pos, pos + 1,
+                                          std::memory_order_relaxed)) {
+          return cell;
+        }
+      } else if (diff < 0) {
+        if (!wait) {
+          return nullptr;
+        }
+        std::this_thread::yield();
+        pos = counter.load(std::memory_order_relaxed);
+      } else {
+        pos = counter.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_;
+  alignas(kCacheLine) CellAlloc alloc_;
+  const size_type mask_;
+  Cell *const cells_;
+};
+
+}  // namespace s21
+
+#endif  // s21_mpmc_queue_h
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(MpmcQueueTest, CapacityIsPowerOfTwo) {
+  s21::MpmcQueue<int> q(100);
+  EXPECT_EQ(q.capacity(), 128u);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, TryPushPopFifo) {
+  s21::MpmcQueue<std::string> q(2);
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_emplace(2, 'b'));
+  EXPECT_FALSE(q.try_push("full"));
+  EXPECT_EQ(q.size_approx(), 2u);
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  q.push("c");
+  q.pop(out);
+  EXPECT_EQ(out, "bb");
+  q.pop(out);
+  EXPECT_EQ(out, "c");
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(MpmcQueueTest, WrapsManyTimes) {
+  s21::MpmcQueue<int> q(4);
+  for (int i = 0; i < 1000; ++i) {
+    q.push(i);
+    q.push(i + 1);
+    int out = -1;
+    q.pop(out);
+    EXPECT_EQ(out, i);
+    q.pop(out);
+    EXPECT_EQ(out, i + 1);
+  }
+}
+
+TEST(MpmcQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::MpmcQueue<std::shared_ptr<int>> q(4);
+    q.push(counter);
+    q.push(counter);
+    std::shared_ptr<int> out;
+    q.pop(out);
+    out.reset();
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueueTest, MoveOnly) {
+  s21::MpmcQueue<std::unique_ptr<int>> q(2);
+  q.emplace(new int(21));
+  std::unique_ptr<int> out;
+  q.pop(out);
+  EXPECT_EQ(*out, 21);
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 3;
+  constexpr int kPerProducer = 20000;
+  constexpr int kTotal = kProducers * kPerProducer;
+  s21::MpmcQueue<int> q(16);
+  std::vector<std::atomic<int>> seen(kTotal);
+  std::atomic<int> popped(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        int value = p * kPerProducer + i;
+        if (i % 2 == 0) {
+          q.push(value);
+        } else {
+          while (!q.try_push(value)) {
+            std::this_thread::yield();
+          }
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      std::vector<int> last(kProducers, -1);
+      int value;
+      while (popped.load() < kTotal) {
+        if (!q.try_pop(value)) {
+          std::this_thread::yield();
+          continue;
+        }
+        popped.fetch_add(1);
+        seen[value].fetch_add(1);
+        // each producer's values reach any one consumer in order
+        int producer = value / kPerProducer;
+        EXPECT_GT(value, last[producer]);
+        last[producer] = value;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(popped.load(), kTotal);
+  for (int i = 0; i < kTotal; ++i) {
+    ASSERT_EQ(seen[i].load(), 1) << i;
+  }
+  EXPECT_TRUE(q.empty());
+}
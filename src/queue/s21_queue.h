@@ -3,63 +3,79 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
-template <typename T>
+// FIFO queue stored in a growable circular buffer: elements live in
+// [head_, head_ + size_) modulo capacity_, so push and pop are amortized O(1)
+// and never move the elements that stay in the queue.
+template <typename T, typename Alloc = std::allocator<T>>
 class Queue {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using allocator_type = Alloc;
 
   // default constructor, creates empty queue
-  Queue() : data_(nullptr), size_(0) {}
+  Queue() noexcept(std::is_nothrow_default_constructible_v<Alloc>)
+      : alloc_(), data_(nullptr), head_(0), size_(0), capacity_(0) {}
 
   // initializer list constructor, creates queue initizialized using
   Queue(std::initializer_list<value_type> const &items) : Queue() {
-    if (items.size() != 0) {
-      size_ = items.size();
-      data_ = new value_type[size_];
-      std::move(items.begin(), items.end(), data_);
+    reserve(items.size());
+    for (const auto &item : items) {
+      push(item);
     }
   }
 
   // copy constructor
-  Queue(const Queue &q) {
-    if (&q != this) {
-      size_ = q.size_;
-      data_ = new value_type[size_];
-      std::copy(q.data_, q.data_ + size_, data_);
+  Queue(const Queue &q) : Queue() {
+    reserve(q.size_);
+    for (size_type i = 0; i < q.size_; ++i) {
+      push(q.data_[q.Index(i)]);
     }
   }
 
   // move constructor
-  Queue(Queue &&q) noexcept {
-    size_ = q.size_;
-    data_ = q.data_;
-    q.size_ = 0;
+  Queue(Queue &&q) noexcept
+      : alloc_(std::move(q.alloc_)),
+        data_(q.data_),
+        head_(q.head_),
+        size_(q.size_),
+        capacity_(q.capacity_) {
     q.data_ = nullptr;
+    q.head_ = 0;
+    q.size_ = 0;
+    q.capacity_ = 0;
   }
 
-  // operator overload for moving object
-  Queue &operator=(Queue &&q) {
+  // operator overload for copying object
+  Queue &operator=(const Queue &q) {
     if (this != &q) {
-      delete[] data_;
-
-      size_ = q.size_;
-      data_ = q.data_;
+      Queue copy(q);
+      swap(copy);
+    }
+    return *this;
+  }
 
-      q.size_ = 0;
-      q.data_ = nullptr;
+  // operator overload for moving object
+  Queue &operator=(Queue &&q) noexcept {
+    if (this != &q) {
+      Queue moved(std::move(q));
+      swap(moved);
     }
     return *this;
   }
 
   // destructor
   ~Queue() {
-    size_ = 0;
-    delete[] data_;
+    clear();
+    Deallocate(data_, capacity_);
   }
 
   // access the first element
@@ -67,7 +83,7 @@ class Queue {
     if (empty()) {
       throw std::out_of_range("Queue is empty");
     }
-    return data_[0];
+    return data_[head_];
   }
 
   // access the last element
@@ -75,7 +91,7 @@ class Queue {
     if (empty()) {
       throw std::out_of_range("Queue is empty");
     }
-    return data_[size_ - 1];
+    return data_[Index(size_ - 1)];
   }
 
   // checks whether the container is empty
@@ -84,18 +100,25 @@ class Queue {
   // returns the number of elements in container
   size_type size() const { return size_; }
 
-  // inserts element at the end
-  void push(const_reference value) {
-    try {
-      value_type *newData = new value_type[size_ + 1];
-      std::copy(data_, data_ + size_, newData);
-      newData[size_] = std::move(value);
-      delete[] data_;
-      data_ = newData;
-      size_ += 1;
-    } catch (const std::bad_alloc &e) {
-      std::cerr << "Exception caught: " << e.what() << std::endl;
+  // returns the number of elements that fit without reallocation
+  size_type capacity() const { return capacity_; }
+
+  // inserts element at the end, doubling the buffer when it is full
+  void push(const_reference value) { emplace(value); }
+
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  // constructs an element in place at the end
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    if (size_ == capacity_) {
+      GrowAndEmplace(std::forward<Args>(args)...);
+    } else {
+      std::allocator_traits<Alloc>::construct(alloc_, data_ + Index(size_),
+                                              std::forward<Args>(args)...);
     }
+    ++size_;
+    return data_[Index(size_ - 1)];
   }
 
   // removes the first element
@@ -103,27 +126,131 @@ class Queue {
     if (empty()) {
       throw std::out_of_range("Queue is empty");
     }
-    value_type *newData = new value_type[size_ - 1];
-    std::copy(data_ + 1, data_ + size_, newData);
-    delete[] data_;
-    data_ = newData;
-    size_ -= 1;
+    std::allocator_traits<Alloc>::destroy(alloc_, data_ + head_);
+    head_ = Index(1);
+    --size_;
+    if (size_ == 0) {
+      head_ = 0;
+    }
   }
 
   // 	swaps the contents
-  void swap(Queue &q) {
-    value_type *tempData = data_;
-    data_ = q.data_;
-    q.data_ = tempData;
+  void swap(Queue &q) noexcept {
+    std::swap(alloc_, q.alloc_);
+    std::swap(data_, q.data_);
+    std::swap(head_, q.head_);
+    std::swap(size_, q.size_);
+    std::swap(capacity_, q.capacity_);
+  }
+
+  // pre-sizes the buffer so that new_cap elements fit without reallocation
+  void reserve(size_type new_cap) {
+    if (new_cap > capacity_) {
+      Reallocate(new_cap);
+    }
+  }
+
+  // releases unused capacity; the queue never shrinks on its own
+  void shrink_to_fit() {
+    if (capacity_ > size_) {
+      Reallocate(size_);
+    }
+  }
 
-    size_type tempSize = size_;
-    size_ = q.size_;
-    q.size_ = tempSize;
+  // destroys all elements, keeping the buffer
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      std::allocator_traits<Alloc>::destroy(alloc_, data_ + Index(i));
+    }
+    head_ = 0;
+    size_ = 0;
   }
 
  private:
+  static constexpr size_type kMinCapacity = 8;
+
+  Alloc alloc_;
   value_type *data_;
+  size_type head_;
   size_type size_;
+  size_type capacity_;
+
+  // physical slot of the i-th element counting from the front
+  size_type Index(size_type i) const {
+    i += head_;
+    return i < capacity_ ? i : i - capacity_;
+  }
+
+  // moves the elements into a new buffer of new_cap slots, front first
+  void Reallocate(size_type new_cap) {
+    value_type *new_data =
+        new_cap == 0
+            ? nullptr
+            : std::allocator_traits<Alloc>::allocate(alloc_, new_cap);
+    try {
+      MoveElements(new_data);
+    } catch (...) {
+      Deallocate(new_data, new_cap);
+      throw;
+    }
+    Adopt(new_data, new_cap);
+  }
+
+  // Doubles the buffer and constructs the new back element in it before the
+  // old elements move, since args may refer to one of them.
+  template <typename... Args>
+  void GrowAndEmplace(Args &&...args) {
+    size_type new_cap = capacity_ == 0 ? kMinCapacity : capacity_ * 2;
+    value_type *new_data =
+        std::allocator_traits<Alloc>::allocate(alloc_, new_cap);
+    try {
+      std::allocator_traits<Alloc>::construct(alloc_, new_data + size_,
+                                              std::forward<Args>(args)...);
+      try {
+        MoveElements(new_data);
+      } catch (...) {
+        std::allocator_traits<Alloc>::destroy(alloc_, new_data + size_);
+        throw;
+      }
+    } catch (...) {
+      Deallocate(new_data, new_cap);
+      throw;
+    }
+    Adopt(new_data, new_cap);
+  }
+
+  // move-constructs the elements into new_data[0, size_); on failure the
+  // ones already built are destroyed and the queue is unchanged
+  void MoveElements(value_type *new_data) {
+    size_type i = 0;
+    try {
+      for (; i < size_; ++i) {
+        std::allocator_traits<Alloc>::construct(
+            alloc_, new_data + i, std::move_if_noexcept(data_[Index(i)]));
+      }
+    } catch (...) {
+      for (size_type j = 0; j < i; ++j) {
+        std::allocator_traits<Alloc>::destroy(alloc_, new_data + j);
+      }
+      throw;
+    }
+  }
+
+  // releases the old buffer and switches to new_data holding size_ elements
+  void Adopt(value_type *new_data, size_type new_cap) {
+    size_type size = size_;
+    clear();
+    Deallocate(data_, capacity_);
+    data_ = new_data;
+    size_ = size;
+    capacity_ = new_cap;
+  }
+
+  void Deallocate(value_type *data, size_type capacity) {
+    if (data != nullptr) {
+      std::allocator_traits<Alloc>::deallocate(alloc_, data, capacity);
+    }
+  }
 };
 }  // namespace s21
 
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+
 #include "../s21_containers.h"
 
 // Tests case for default constructor and empty method
@@ -285,3 +288,121 @@ TEST(QueueTest, SwapChar) {
   EXPECT_EQ(queue1.back(), '6');
   EXPECT_EQ(queue2.back(), '3');
 }
+
+// Test case for ring buffer wrap-around
+TEST(QueueTest, WrapAroundInt) {
+  s21::Queue<int> intQueue;
+  intQueue.reserve(4);
+  for (int i = 0; i < 100; ++i) {
+    intQueue.push(i);
+    intQueue.push(i + 1000);
+    EXPECT_EQ(intQueue.back(), i + 1000);
+    intQueue.pop();
+  }
+  EXPECT_EQ(intQueue.size(), 100u);
+  for (int i = 50; i < 100; ++i) {
+    EXPECT_EQ(intQueue.front(), i);
+    intQueue.pop();
+    EXPECT_EQ(intQueue.front(), i + 1000);
+    intQueue.pop();
+  }
+  EXPECT_TRUE(intQueue.empty());
+}
+
+TEST(QueueTest, WrapAroundString) {
+  s21::Queue<std::string> stringQueue = {"a", "b", "c"};
+  stringQueue.pop();
+  stringQueue.push("d");
+  stringQueue.push("e");
+  s21::Queue<std::string> copied(stringQueue);
+  EXPECT_EQ(copied.size(), 4u);
+  EXPECT_EQ(copied.front(), "b");
+  EXPECT_EQ(copied.back(), "e");
+  stringQueue.shrink_to_fit();
+  EXPECT_EQ(stringQueue.capacity(), 4u);
+  EXPECT_EQ(stringQueue.front(), "b");
+  EXPECT_EQ(stringQueue.back(), "e");
+}
+
+// Test case for reserve and shrink_to_fit methods
+TEST(QueueTest, ReserveAndShrink) {
+  s21::Queue<int> intQueue;
+  intQueue.reserve(1000);
+  EXPECT_EQ(intQueue.capacity(), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    intQueue.push(i);
+  }
+  EXPECT_EQ(intQueue.capacity(), 1000u);
+  for (int i = 0; i < 990; ++i) {
+    intQueue.pop();
+  }
+  intQueue.shrink_to_fit();
+  EXPECT_EQ(intQueue.capacity(), 10u);
+  EXPECT_EQ(intQueue.front(), 990);
+  EXPECT_EQ(intQueue.back(), 999);
+  intQueue.reserve(5);
+  EXPECT_EQ(intQueue.capacity(), 10u);
+}
+
+// Test case for copy assignment operator =
+TEST(QueueTest, CopyAssignmentInt) {
+  s21::Queue<int> original = {1, 2, 3};
+  s21::Queue<int> assigned = {7};
+  assigned = original;
+  EXPECT_EQ(assigned.size(), 3u);
+  EXPECT_EQ(assigned.front(), 1);
+  EXPECT_EQ(assigned.back(), 3);
+  EXPECT_EQ(original.size(), 3u);
+}
+
+TEST(QueueTest, PopEmptyThrows) {
+  s21::Queue<int> intQueue;
+  EXPECT_THROW(intQueue.pop(), std::out_of_range);
+  EXPECT_THROW(intQueue.front(), std::out_of_range);
+  EXPECT_THROW(intQueue.back(), std::out_of_range);
+}
+
+TEST(QueueTest, EmplaceInPlace) {
+  s21::Queue<std::pair<int, std::string>> q;
+  auto &ref = q.emplace(1, "one");
+  q.emplace(2, std::string(3, 'x'));
+  EXPECT_EQ(&ref, &q.front());
+  EXPECT_EQ(q.back().second, "xxx");
+  EXPECT_EQ(q.size(), 2u);
+}
+
+TEST(QueueTest, MoveOnly) {
+  s21::Queue<std::unique_ptr<int>> q;
+  for (int i = 0; i < 20; ++i) {
+    q.push(std::make_unique<int>(i));
+  }
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(*q.front(), i);
+    q.pop();
+  }
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(QueueTest, EmplaceOwnElementWhenFull) {
+  s21::Queue<std::string> q;
+  q.push("first");
+  q.push("second");
+  q.pop();
+  q.push("third");
+  q.shrink_to_fit();
+  q.emplace(q.front());
+  q.push(q.back());
+  EXPECT_EQ(q.size(), 4u);
+  q.pop();
+  q.pop();
+  EXPECT_EQ(q.front(), "second");
+  EXPECT_EQ(q.back(), "second");
+}
+
+TEST(QueueTest, PushRvalueMoves) {
+  s21::Queue<std::string> q;
+  std::string value(100, 'a');
+  q.push(std::move(value));
+  EXPECT_EQ(q.front(), std::string(100, 'a'));
+  EXPECT_TRUE(value.empty());
+}
@@ -0,0 +1,175 @@
+#ifndef s21_spsc_queue_h
+#define s21_spsc_queue_h
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Bounded lock-free FIFO for exactly one producer thread and one consumer
+// thread. Slots live in a power-of-two ring; head_ and tail_ only grow and are
+// masked on access. Each index is written by one side only and published with
+// a release store, so the other side sees the slot contents after its acquire
+// load. Both sides also keep a private copy of the other's index and reload
+// it only when the ring looks full (producer) or empty (consumer), which
+// keeps the shared cache lines from bouncing on every operation.
+template <typename T, typename Alloc = std::allocator<T>>
+class SpscQueue {
+ public:
+  using value_type = typename Queue<T, Alloc>::value_type;
+  using reference = typename Queue<T, Alloc>::reference;
+  using const_reference = typename Queue<T, Alloc>::const_reference;
+  using size_type = typename Queue<T, Alloc>::size_type;
+  using allocator_type = typename Queue<T, Alloc>::allocator_type;
+
+  // capacity is rounded up to a power of two, at least 2
+  explicit SpscQueue(size_type capacity)
+      : tail_(0),
+        cached_head_(0),
+        head_(0),
+        cached_tail_(0),
+        alloc_(),
+        mask_(RoundUp(capacity) - 1),
+        data_(std::allocator_traits<Alloc>::allocate(alloc_, mask_ + 1)) {}
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  ~SpscQueue() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) {
+      std::allocator_traits<Alloc>::destroy(alloc_, Slot(head));
+    }
+    std::allocator_traits<Alloc>::deallocate(alloc_, data_, mask_ + 1);
+  }
+
+  // producer side: returns false if the queue is full
+  bool try_push(const_reference value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) {
+        return false;
+      }
+    }
+    std::allocator_traits<Alloc>::construct(alloc_, Slot(tail),
+                                            std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // producer side: pushes up to n elements from first and publishes them
+  // with a single store; returns how many fit
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type n) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type free = mask_ + 1 - (tail - cached_head_);
+    if (free < n) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      free = mask_ + 1 - (tail - cached_head_);
+    }
+    size_type count = n < free ? n : free;
+    size_type i = 0;
+    try {
+      for (; i < count; ++i, ++first) {
+        std::allocator_traits<Alloc>::construct(alloc_, Slot(tail + i),
+                                                *first);
+      }
+    } catch (...) {
+      while (i != 0) {
+        std::allocator_traits<Alloc>::destroy(alloc_, Slot(tail + --i));
+      }
+      throw;
+    }
+    tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // consumer side: moves the oldest element into out, false if empty
+  bool try_pop(reference out) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return false;
+      }
+    }
+    out = std::move(*Slot(head));
+    std::allocator_traits<Alloc>::destroy(alloc_, Slot(head));
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer side: moves up to n elements to out and frees their slots with
+  // a single store; returns how many were taken
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type ready = cached_tail_ - head;
+    if (ready < n) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      ready = cached_tail_ - head;
+    }
+    size_type count = n < ready ? n : ready;
+    size_type i = 0;
+    try {
+      for (; i < count; ++i, ++out) {
+        *out = std::move(*Slot(head + i));
+        std::allocator_traits<Alloc>::destroy(alloc_, Slot(head + i));
+      }
+    } catch (...) {
+      head_.store(head + i, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // exact only while neither side is running
+  size_type size_approx() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool empty() const noexcept { return size_approx() == 0; }
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  static size_type RoundUp(size_type n) {
+    size_type cap = 2;
+    while (cap < n) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  T *Slot(size_type index) const noexcept { return data_ + (index & mask_); }
+
+  // written by the producer
+  alignas(kCacheLine) std::atomic<size_type> tail_;
+  size_type cached_head_;
+  // written by the consumer
+  alignas(kCacheLine) std::atomic<size_type> head_;
+  size_type cached_tail_;
+  // read-only after construction
+  alignas(kCacheLine) Alloc alloc_;
+  const size_type mask_;
+  T *const data_;
+};
+
+}  // namespace s21
+
+#endif  // s21_spsc_queue_h
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(SpscQueueTest, CapacityIsPowerOfTwo) {
+  s21::SpscQueue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8u);
+  s21::SpscQueue<int> q2(16);
+  EXPECT_EQ(q2.capacity(), 16u);
+  s21::SpscQueue<int> q3(0);
+  EXPECT_EQ(q3.capacity(), 2u);
+}
+
+TEST(SpscQueueTest, PushPopFifo) {
+  s21::SpscQueue<std::string> q(4);
+  EXPECT_TRUE(q.empty());
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_emplace(2, 'b'));
+  std::string c = "c";
+  EXPECT_TRUE(q.try_push(c));
+  EXPECT_TRUE(q.try_push(std::move(c)));
+  EXPECT_FALSE(q.try_push("full"));
+  EXPECT_EQ(q.size_approx(), 4u);
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "bb");
+  EXPECT_TRUE(q.try_push("d"));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "c");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "d");
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueTest, BulkPushPop) {
+  s21::SpscQueue<int> q(8);
+  std::vector<int> in = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.push_n(in.begin(), in.size()), 8u);
+  EXPECT_EQ(q.push_n(in.begin(), 1), 0u);
+  std::vector<int> out(10, 0);
+  EXPECT_EQ(q.pop_n(out.begin(), 3), 3u);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_EQ(q.push_n(in.begin() + 8, 2), 2u);
+  EXPECT_EQ(q.pop_n(out.begin() + 3, 10), 7u);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(out[i], i + 1);
+  }
+}
+
+TEST(SpscQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::SpscQueue<std::shared_ptr<int>> q(4);
+    q.try_push(counter);
+    q.try_push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueueTest, MoveOnly) {
+  s21::SpscQueue<std::unique_ptr<int>> q(2);
+  EXPECT_TRUE(q.try_push(std::make_unique<int>(21)));
+  std::unique_ptr<int> out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(*out, 21);
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+  constexpr int kCount = 200000;
+  s21::SpscQueue<int> q(64);
+  std::thread producer([&q] {
+    for (int i = 0; i < kCount;) {
+      if (i % 3 == 0) {
+        int batch[5] = {i, i + 1, i + 2, i + 3, i + 4};
+        int n = kCount - i < 5 ? kCount - i : 5;
+        i += static_cast<int>(q.push_n(batch, n));
+      } else if (q.try_push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  int buffer[7];
+  while (expected < kCount) {
+    size_t n = q.pop_n(buffer, 7);
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(buffer[i], expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(q.empty());
+}
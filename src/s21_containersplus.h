@@ -4,7 +4,20 @@
 
 #include <iostream>
 
+#include "allocator/s21_pool_allocator.h"
 #include "array/s21_array.h"
+#include "btree/s21_btree_map.h"
+#include "cache/s21_cache.h"
+#include "flat/s21_flat_map.h"
+#include "flat/s21_flat_set.h"
+#include "list/s21_intrusive_list.h"
+#include "map/s21_sharded_map.h"
 #include "multiset/s21_multiset.h"
+#include "queue/s21_mpmc_queue.h"
+#include "queue/s21_spsc_queue.h"
+#include "stack/s21_lock_free_stack.h"
+#include "unordered/s21_unordered_map.h"
+#include "unordered/s21_unordered_set.h"
+#include "vector/s21_small_vector.h"
 
 #endif  //S21_CONTAINERSPLUS_H_
@@ -1,12 +1,20 @@
 #ifndef RB_TREE_H
 #define RB_TREE_H
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <queue>    // для вывода - не обзязательно
+#include <stdexcept>
+#include <type_traits>
 #include <utility>  // для использования std::pair
+#include <vector>
+
+#include "../allocator/s21_pool_allocator.h"
 
 namespace s21 {
-template <typename Key, typename Data>
+template <typename Key, typename Data, typename Alloc = std::allocator<Data>>
 class RBTree {
  public:
   class TreeIterator;  // итераторы
@@ -25,9 +33,12 @@ class RBTree {
   using pointer = data_type *;
   using reference = data_type &;
   using iterator_category = std::bidirectional_iterator_tag;
+  using allocator_type = Alloc;
+  using NodeAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<TreeNode>;
 
   // Конструктор по умолчанию
-  RBTree() : root_(nullptr), size_(0) {}
+  RBTree() : alloc_node_(), root_(nullptr), size_(0) {}
 
   /*Конструктор с параметрами
   Позваляет инициализировать в виде:
@@ -38,26 +49,29 @@ class RBTree {
   };*/
   RBTree(
       std::initializer_list<std::pair<const key_type, const data_type>> values)
-      : root_(nullptr), size_(0) {
+      : alloc_node_(), root_(nullptr), size_(0) {
     for (const auto &pair : values) {
       insert(pair.first, pair.second);
     }
   }
 
   RBTree(std::initializer_list<data_type> const &items)
-      : root_(nullptr), size_(0) {
+      : alloc_node_(), root_(nullptr), size_(0) {
     for (const auto &item : items) {
       insert(item, item);
     }
   }
   // конструктор перемещения
-  RBTree(RBTree &&other) noexcept : root_(other.root_), size_(other.size_) {
+  RBTree(RBTree &&other) noexcept
+      : alloc_node_(other.alloc_node_),
+        root_(other.root_),
+        size_(other.size_) {
     other.root_ = nullptr;
     other.size_ = 0;
   }
 
   // конструктор копирования
-  RBTree(const RBTree &other) : root_(nullptr), size_(0) {
+  RBTree(const RBTree &other) : alloc_node_(), root_(nullptr), size_(0) {
     // Рекурсивно копируем узлы из другого дерева
     root_ = copyTree(other.root_, nullptr);
     size_ = other.size_;
@@ -69,7 +83,8 @@ class RBTree {
       // Очищаем текущее дерево перед перемещением данных
       clear();
 
-      // Перемещаем корень и размер из другого объекта
+      // Перемещаем корень, размер и аллокатор, владеющий узлами
+      std::swap(alloc_node_, other.alloc_node_);
       root_ = other.root_;
       size_ = other.size_;
 
@@ -88,15 +103,115 @@ class RBTree {
   }
 
   // Метод вставки
-  void insert(const key_type &key, const data_type &data) {
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const data_type &data) {
+    return insertData(key, data);
+  }
+
+  // Вставка с перемещением данных в узел
+  std::pair<iterator, bool> insert(const key_type &key, data_type &&data) {
+    return insertData(key, std::move(data));
+  }
+
+  // Строит значение прямо в новом узле и ищет место по нему самому; только
+  // для множества (Key == Data). Если ключ уже есть, узел уничтожается
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    static_assert(kKeyIsData, "emplace builds the key from the value");
+    TreeNode *newNode = createNode(std::in_place, std::forward<Args>(args)...);
+    TreeNode *existing = findNode(newNode->key());
+    if (existing != nullptr) {
+      destroyNode(newNode);
+      return std::make_pair(iterator(existing), false);
+    }
+    insertNode(newNode);
+    fixInsertion(newNode);
+    return std::make_pair(iterator(newNode), true);
+  }
+
+ private:
+  template <typename D>
+  std::pair<iterator, bool> insertData(const key_type &key, D &&data) {
     // Проверяем на наличие ключча
-    if (contains(key)) return;
+    TreeNode *existing = findNode(key);
+    if (existing != nullptr) return std::make_pair(iterator(existing), false);
     // Создаем новый узел с переданными значениями
-    TreeNode *newNode = new TreeNode(key, data, Color::RED);
+    TreeNode *newNode = createNode(key, std::forward<D>(data), Color::RED);
     // Выполняем обычную вставку как в двоичном дереве поиска
     insertNode(newNode);
     // Выполняем балансировку после вставки
     fixInsertion(newNode);
+    return std::make_pair(iterator(newNode), true);
+  }
+
+ public:
+  // Метод lower_bound: первый элемент с ключом не меньше key
+  iterator lower_bound(const Key &key) {
+    TreeNode *current = root_;
+    TreeNode *result = nullptr;
+
+    while (current != nullptr) {
+      if (current->key() < key) {
+        current = current->right_;
+      } else {
+        result = current;
+        current = current->left_;
+      }
+    }
+
+    return iterator(result);
+  }
+
+  // Метод upper_bound: первый элемент с ключом больше key
+  iterator upper_bound(const Key &key) {
+    TreeNode *current = root_;
+    TreeNode *result = nullptr;
+
+    while (current != nullptr) {
+      if (key < current->key()) {
+        result = current;
+        current = current->left_;
+      } else {
+        current = current->right_;
+      }
+    }
+
+    return iterator(result);
+  }
+
+  // Метод equal_range: ключи не повторяются, поэтому в диапазоне не больше
+  // одного элемента и второй спуск по дереву не нужен
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    iterator lower = lower_bound(key);
+    iterator upper = lower;
+    if (lower != end() && !(key < lower.key())) {
+      ++upper;
+    }
+    return std::make_pair(lower, upper);
+  }
+
+  // Ленивый диапазон [first, last): хранит только два итератора, элементы
+  // обходятся по мере продвижения
+  class RangeView {
+   public:
+    RangeView(iterator first, iterator last) : first_(first), last_(last) {}
+
+    iterator begin() const { return first_; }
+    iterator end() const { return last_; }
+    bool empty() const { return first_ == last_; }
+
+   private:
+    iterator first_;
+    iterator last_;
+  };
+
+  // Элементы с lo <= ключ < hi за два спуска по дереву; пусто, если не lo < hi
+  RangeView range(const key_type &lo, const key_type &hi) {
+    iterator first = lower_bound(lo);
+    if (!(lo < hi)) {
+      return RangeView(first, first);
+    }
+    return RangeView(first, lower_bound(hi));
   }
 
   void erase(const key_type &key) {
@@ -130,11 +245,71 @@ class RBTree {
   // Метод для проверки наличия ключа в дереве
   bool contains(const key_type &key) const { return findNode(key) != nullptr; }
 
+  // Ключи не повторяются, поэтому 0 или 1
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Число элементов с ключом меньше key, то есть номер lower_bound(key);
+  // спуск по размерам поддеревьев, O(log n)
+  size_type rank(const key_type &key) const {
+    size_type result = 0;
+    TreeNode *node = root_;
+    while (node != nullptr) {
+      if (node->key() < key) {
+        result += subtreeSize(node->left_) + 1;
+        node = node->right_;
+      } else {
+        node = node->left_;
+      }
+    }
+    return result;
+  }
+
+  // Элемент с номером k по возрастанию (с нуля) за O(log n); end(), если
+  // k >= size()
+  iterator select(size_type k) {
+    TreeNode *node = root_;
+    while (node != nullptr) {
+      size_type left = subtreeSize(node->left_);
+      if (k < left) {
+        node = node->left_;
+      } else if (k == left) {
+        break;
+      } else {
+        k -= left + 1;
+        node = node->right_;
+      }
+    }
+    return iterator(node);
+  }
+
+  iterator nth(size_type k) { return select(k); }
+
+  // Номер элемента под итератором, size() для end(), O(log n)
+  size_type index_of(iterator pos) const {
+    TreeNode *node = pos.get_node();
+    if (node == nullptr) {
+      return size_;
+    }
+    size_type result = subtreeSize(node->left_);
+    for (; node->parent_ != nullptr; node = node->parent_) {
+      if (node == node->parent_->right_) {
+        result += subtreeSize(node->parent_->left_) + 1;
+      }
+    }
+    return result;
+  }
+
+  // Число шагов от first до last (first не правее last) без обхода, O(log n)
+  size_type distance(iterator first, iterator last) const {
+    return index_of(last) - index_of(first);
+  }
+
   // Метод для очистки дерева
   void clear() {
     clearRecursive(root_);  // Рекурсивное удаление всех узлов дерева
     root_ = nullptr;
     size_ = 0;
+    ReleaseNodes(alloc_node_);  // пул аллокатора освобождается целиком
   }
 
   iterator begin() {
@@ -146,10 +321,88 @@ class RBTree {
 
   // Метод обмена содержимым двух деревьев
   void swap(RBTree &other) noexcept {
+    std::swap(alloc_node_, other.alloc_node_);
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
   }
 
+  // Вставка диапазона написана под множество. Отсортированный диапазон не
+  // меньше восьмой части дерева сливается с деревом за O(size() + n);
+  // остальные вставляются по одному
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void insertRange(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      if (count >= size_ / kBulkInsertRatio && std::is_sorted(first, last)) {
+        insertSorted(first, last);
+        return;
+      }
+    }
+    for (; first != last; ++first) {
+      insert(*first, *first);
+    }
+  }
+
+  // Слияние отсортированного диапазона с деревом за один проход: узлы
+  // дерева и новые узлы собираются по порядку в массив, из которого
+  // заново связывается идеально сбалансированное дерево, без поворотов;
+  // ключи, которые уже есть, и повторы внутри диапазона пропускаются.
+  // Неотсортированный диапазон - std::invalid_argument, дерево не меняется
+  template <typename InputIt>
+  void insertSorted(InputIt first, InputIt last) {
+    std::vector<TreeNode *> old;
+    old.reserve(size_);
+    collectNodes(root_, old);
+    std::vector<TreeNode *> nodes;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      nodes.reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+    TreeNode *last_node = nullptr;
+    auto append = [&nodes, &last_node](TreeNode *node) {
+      nodes.push_back(node);
+      last_node = node;
+    };
+    size_type i = 0;
+    try {
+      for (; first != last; ++first) {
+        const key_type &key = *first;
+        while (i < old.size() && old[i]->key() < key) {
+          append(old[i++]);
+        }
+        if (i < old.size() && !(key < old[i]->key())) {
+          continue;  // ключ уже есть в дереве
+        }
+        if (last_node != nullptr && !(last_node->key() < key)) {
+          if (key < last_node->key()) {
+            throw std::invalid_argument("range is not sorted");
+          }
+          continue;  // повтор внутри диапазона
+        }
+        append(createNode(key, *first, Color::RED));
+      }
+    } catch (...) {
+      // новые узлы - те, которых нет в old; порядок у обоих массивов общий
+      size_type j = 0;
+      for (TreeNode *node : nodes) {
+        if (j < old.size() && node == old[j]) {
+          ++j;
+        } else {
+          destroyNode(node);
+        }
+      }
+      throw;
+    }
+    while (i < old.size()) {
+      append(old[i++]);
+    }
+    root_ = linkBalanced(nodes.data(), 0, nodes.size(), nullptr, 0,
+                         redLevel(nodes.size()));
+    size_ = nodes.size();
+  }
+
   // Метод объединения содержимого двух деревьев написан под множество
   void merge(RBTree &other) {
     // Добавляем все элементы из другого множества
@@ -182,7 +435,7 @@ class RBTree {
   //     }
 
   //     std::string color = (current->color_ == Color::RED) ? "RED" : "BLACK";
-  //     std::cout << current->key_ << " : " << current->data_ << " " << color
+  //     std::cout << current->key() << " : " << current->data_ << " " << color
   //               << " | ";
 
   //     if (current->left_) {
@@ -204,41 +457,73 @@ class RBTree {
   //   if (node) {
   //     print_tree(node->left_);
   //     std::string color = (node->color_ == Color::RED) ? "RED" : "BLACK";
-  //     std::cout << "key: " << node->key_ << " : " << node->data_
+  //     std::cout << "key: " << node->key() << " : " << node->data_
   //               << " color: " << color << std::endl;
   //     print_tree(node->right_);
   //   }
   // }
 
   //////////////////////////////// узел дерева ////////////////////////////////
-  typedef struct TreeNode {
-    key_type key_;                // ключ
+  // У множества (Key == Data) ключом служат сами данные: узел хранит их
+  // один раз, а отдельное поле ключа есть только у NodeKey
+  static constexpr bool kKeyIsData = std::is_same_v<key_type, data_type>;
+
+  struct NodeKey {
+    template <typename K>
+    explicit NodeKey(K &&key) : key_(std::forward<K>(key)) {}
+    key_type key_;  // ключ
+  };
+
+  struct NoNodeKey {
+    NoNodeKey() = default;
+    template <typename K>
+    explicit NoNodeKey(K &&) {}
+  };
+
+  typedef struct TreeNode
+      : std::conditional_t<kKeyIsData, NoNodeKey, NodeKey> {
+    using KeyBase = std::conditional_t<kKeyIsData, NoNodeKey, NodeKey>;
+
     data_type data_;              // значение
     TreeNode *parent_ = nullptr;  // указатель на родителя
     TreeNode *left_ = nullptr;  // левый ребенок указатель
     TreeNode *right_ = nullptr;  // правый ребенок указатель
     Color color_ = Color::RED;  // цвет узла
-
-    // конструктор с всеми параметрами
-    TreeNode(key_type key, data_type data, Color color)
-        : key_(key),
-          data_(data),
+    size_type count_ = 1;  // число узлов в поддереве с корнем в этом узле
+
+    // конструктор с всеми параметрами; у множества key лишь используется для
+    // поиска и в узел не копируется
+    template <typename K, typename D>
+    TreeNode(K &&key, D &&data, Color color = Color::RED)
+        : KeyBase(std::forward<K>(key)),
+          data_(std::forward<D>(data)),
           parent_(nullptr),
           left_(nullptr),
           right_(nullptr),
-          color_(color) {}
-
-    // конструктор без цвета, используется красный цвет по умолчанию
-    TreeNode(key_type key, data_type data)
-        : key_(key),
-          data_(data),
+          color_(color),
+          count_(1) {}
+
+    // конструктор, строящий значение множества прямо в узле
+    template <typename... Args>
+    explicit TreeNode(std::in_place_t, Args &&...args)
+        : KeyBase(),
+          data_(std::forward<Args>(args)...),
           parent_(nullptr),
           left_(nullptr),
           right_(nullptr),
-          color_(Color::RED) {}
+          color_(Color::RED),
+          count_(1) {}
+
+    const key_type &key() const noexcept {
+      if constexpr (kKeyIsData) {
+        return data_;
+      } else {
+        return this->key_;
+      }
+    }
 
     friend std::ostream &operator<<(std::ostream &os, const TreeNode &node) {
-      os << node.key_;  // Пример вывода ключа
+      os << node.key();  // Пример вывода ключа
       return os;
     }
 
@@ -268,7 +553,7 @@ class RBTree {
 
     // Операторы сравнения
     friend bool operator==(const TreeNode &lhs, const TreeNode &rhs) {
-      return lhs.key_ == rhs.key_;
+      return lhs.key() == rhs.key();
     }
 
     friend bool operator!=(const TreeNode &lhs, const TreeNode &rhs) {
@@ -337,7 +622,7 @@ class RBTree {
       if (current_ == nullptr) {
         throw std::out_of_range("Iterator is out of range");
       }
-      return current_->key_;
+      return current_->key();
     }
     // Возвращает значение где находится итератор
     const data_type &data() const {
@@ -433,7 +718,7 @@ class RBTree {
       if (current_ == nullptr) {
         throw std::out_of_range("Iterator is out of range");
       }
-      return current_->key_;
+      return current_->key();
     }
     // Возвращает значение где находится итератор
     const data_type &data() const {
@@ -449,6 +734,11 @@ class RBTree {
 
   //////////////////////////// приватные методы ////////////////////////////
  private:
+  // Размер поддерева; у пустого - 0
+  static size_type subtreeSize(const TreeNode *node) {
+    return node == nullptr ? 0 : node->count_;
+  }
+
   TreeNode *findLeftmost(TreeNode *node) const {
     if (node == nullptr) return nullptr;
 
@@ -463,9 +753,9 @@ class RBTree {
   TreeNode *findNode(const key_type &key) const {
     TreeNode *current = root_;
     while (current != nullptr) {
-      if (key < current->key_) {
+      if (key < current->key()) {
         current = current->left_;
-      } else if (key > current->key_) {
+      } else if (key > current->key()) {
         current = current->right_;
       } else {
         return current;  // Узел найден
@@ -481,7 +771,8 @@ class RBTree {
     // Ищем место для вставки узла
     while (current != nullptr) {
       parent = current;
-      if (newNode->key_ < current->key_) {
+      ++current->count_;  // новый узел попадет в поддерево current
+      if (newNode->key() < current->key()) {
         current = current->left_;
       } else {
         current = current->right_;
@@ -492,7 +783,7 @@ class RBTree {
     if (parent == nullptr) {
       // Вставка в пустое дерево
       root_ = newNode;
-    } else if (newNode->key_ < parent->key_) {
+    } else if (newNode->key() < parent->key()) {
       parent->left_ = newNode;
     } else {
       parent->right_ = newNode;
@@ -525,6 +816,7 @@ class RBTree {
           if (node == parent->right_) {
             node = parent;
             RotateLeft(node);
+            parent = node->parent_;
           }
 
           parent->color_ = Color::BLACK;
@@ -534,6 +826,7 @@ class RBTree {
           if (node == parent->left_) {
             node = parent;
             RotateRight(node);
+            parent = node->parent_;
           }
 
           parent->color_ = Color::BLACK;
@@ -568,6 +861,9 @@ class RBTree {
 
     leftChild->right_ = node;
     node->parent_ = leftChild;
+
+    leftChild->count_ = node->count_;
+    node->count_ = subtreeSize(node->left_) + subtreeSize(node->right_) + 1;
   }
 
   /*Метод выполняет операцию левого поворота в красно-черном дереве.
@@ -593,6 +889,9 @@ class RBTree {
 
     rightChild->left_ = node;
     node->parent_ = rightChild;
+
+    rightChild->count_ = node->count_;
+    node->count_ = subtreeSize(node->left_) + subtreeSize(node->right_) + 1;
   }
 
   void removeNode(TreeNode *nodeToRemove) {
@@ -624,22 +923,49 @@ class RBTree {
       }
     }
 
+    // Узел replacementNode выпадает из всех поддеревьев на пути к корню
+    for (TreeNode *node = replacementNode->parent_; node != nullptr;
+         node = node->parent_) {
+      --node->count_;
+    }
+
+    TreeNode *childParent = replacementNode->parent_;
+    const Color removedColor = replacementNode->color_;
     if (replacementNode != nodeToRemove) {
-      // Копируем значения заменяемого узла в удаляемый
-      nodeToRemove->key_ = replacementNode->key_;
-      nodeToRemove->data_ = replacementNode->data_;
+      // Ставим преемника на место удаляемого узла вместо копирования значений:
+      // данные не копируются, итераторы на преемника остаются валидными
+      if (childParent == nodeToRemove) childParent = replacementNode;
+      transplantNode(nodeToRemove, replacementNode);
     }
 
-    // Если цвет заменяемого узла черный, восстанавливаем баланс
-    if (replacementNode->color_ == Color::BLACK) {
-      fixDoubleBlack(childNode, replacementNode->parent_);
+    // Если цвет вынутого узла черный, восстанавливаем баланс
+    if (removedColor == Color::BLACK) {
+      fixDoubleBlack(childNode, childParent);
     }
 
-    // Освобождаем память для заменяемого узла
-    delete replacementNode;
+    // Освобождаем память удаляемого узла
+    destroyNode(nodeToRemove);
     size_--;
   }
 
+  // Ставит node на место target: ссылки, цвет и размер поддерева
+  void transplantNode(TreeNode *target, TreeNode *node) noexcept {
+    node->parent_ = target->parent_;
+    node->left_ = target->left_;
+    node->right_ = target->right_;
+    node->color_ = target->color_;
+    node->count_ = target->count_;
+    if (node->left_ != nullptr) node->left_->parent_ = node;
+    if (node->right_ != nullptr) node->right_->parent_ = node;
+    if (node->parent_ == nullptr) {
+      root_ = node;
+    } else if (node->parent_->left_ == target) {
+      node->parent_->left_ = node;
+    } else {
+      node->parent_->right_ = node;
+    }
+  }
+
   TreeNode *findSuccessor(TreeNode *node) {
     // Если у узла есть правое поддерево, то следующим будет самый левый узел в
     // этом поддереве
@@ -748,6 +1074,44 @@ class RBTree {
     }
   }
 
+  // Узлы поддерева в порядке возрастания ключей
+  static void collectNodes(TreeNode *node, std::vector<TreeNode *> &out) {
+    while (node != nullptr) {
+      collectNodes(node->left_, out);
+      out.push_back(node);
+      node = node->right_;
+    }
+  }
+
+  // Глубина, на которой лежат узлы неполного нижнего уровня дерева из n
+  // узлов, собранного linkBalanced (как computeRedLevel в java TreeMap)
+  static int redLevel(size_type n) {
+    int level = 0;
+    for (long long m = static_cast<long long>(n) - 1; m >= 0; m = m / 2 - 1) {
+      ++level;
+    }
+    return level;
+  }
+
+  // Связывает nodes[lo, hi) в сбалансированное поддерево: корень - средний
+  // узел, половины - рекурсивно. Все уровни выше red_level полные и
+  // черные, узлы неполного нижнего уровня красные, поэтому на любом пути
+  // одинаковое число черных узлов и нет двух красных подряд
+  static TreeNode *linkBalanced(TreeNode **nodes, size_type lo, size_type hi,
+                                TreeNode *parent, int level, int red_level) {
+    if (lo >= hi) {
+      return nullptr;
+    }
+    size_type mid = lo + (hi - lo - 1) / 2;
+    TreeNode *node = nodes[mid];
+    node->parent_ = parent;
+    node->color_ = level == red_level ? Color::RED : Color::BLACK;
+    node->count_ = hi - lo;
+    node->left_ = linkBalanced(nodes, lo, mid, node, level + 1, red_level);
+    node->right_ = linkBalanced(nodes, mid + 1, hi, node, level + 1, red_level);
+    return node;
+  }
+
   // Вспомогательный метод для рекурсивного копирования узлов дерева
   TreeNode *copyTree(const TreeNode *srcNode, TreeNode *parent) {
     if (!srcNode) {
@@ -755,8 +1119,9 @@ class RBTree {
     }
     // Копируем текущий узел
     TreeNode *newNode =
-        new TreeNode(srcNode->key_, srcNode->data_, srcNode->color_);
+        createNode(srcNode->key(), srcNode->data_, srcNode->color_);
     newNode->parent_ = parent;
+    newNode->count_ = srcNode->count_;
     // Рекурсивно копируем левое и правое поддерево
     newNode->left_ = copyTree(srcNode->left_, newNode);
     newNode->right_ = copyTree(srcNode->right_, newNode);
@@ -776,10 +1141,35 @@ class RBTree {
     if (node) {
       clearRecursive(node->left_);
       clearRecursive(node->right_);
-      delete node;
+      destroyNode(node);
     }
   }
 
+  // Выделение узла через аллокатор дерева
+  template <typename... Args>
+  TreeNode *createNode(Args &&...args) {
+    TreeNode *node =
+        std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
+    try {
+      std::allocator_traits<NodeAlloc>::construct(alloc_node_, node,
+                                                  std::forward<Args>(args)...);
+    } catch (...) {
+      std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  // Уничтожение узла и возврат памяти аллокатору
+  void destroyNode(TreeNode *node) {
+    std::allocator_traits<NodeAlloc>::destroy(alloc_node_, node);
+    std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, node, 1);
+  }
+
+  // insertRange сливает диапазон с деревом, если он не меньше size_ / 8
+  static constexpr size_type kBulkInsertRatio = 8;
+
+  NodeAlloc alloc_node_;
   TreeNode *root_;
   size_type size_ = 0;
 };
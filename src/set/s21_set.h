@@ -5,37 +5,71 @@
 
 namespace s21 {
 
-template <class Key>
-class Set : public RBTree<Key, Key> {
+template <class Key, class Alloc = std::allocator<Key>>
+class Set : public RBTree<Key, Key, Alloc> {
  public:
   using value_type = Key;
   using key_type = Key;
   using reference = Key &;
   using const_reference = const Key &;
-  using iterator = typename RBTree<Key, Key>::iterator;
-  using const_iterator = typename RBTree<Key, Key>::const_iterator;
+  using iterator = typename RBTree<Key, Key, Alloc>::iterator;
+  using const_iterator = typename RBTree<Key, Key, Alloc>::const_iterator;
   using size_type = size_t;
+  using allocator_type = Alloc;
   using set = Set;
 
  public:
-  Set() : RBTree<Key, Key>() {}
+  Set() : RBTree<Key, Key, Alloc>() {}
   Set(std::initializer_list<value_type> const &items)
-      : RBTree<Key, Key>(items) {}
-  Set(const Set &other) : RBTree<Key, Key>(other) {}
-  Set(Set &&set) : RBTree<Key, Key>(std::move(set)) {}
+      : RBTree<Key, Key, Alloc>(items) {}
+  Set(const Set &other) : RBTree<Key, Key, Alloc>(other) {}
+  Set(Set &&set) : RBTree<Key, Key, Alloc>(std::move(set)) {}
   // Оператор перемещающего присвоения
   Set &operator=(Set &&set) {
     if (this != &set) {
       // Вызываем оператор перемещающего присвоения базового класса
-      RBTree<Key, Key>::operator=(std::move(set));
+      RBTree<Key, Key, Alloc>::operator=(std::move(set));
     }
     return *this;
   }
   ~Set() = default;
 
-  void insert(const key_type &key) {
+  std::pair<iterator, bool> insert(const key_type &key) {
     // Вызываем метод вставки дерева, передавая ключ как и данные
-    RBTree<Key, Key>::insert(key, key);
+    return RBTree<Key, Key, Alloc>::insert(key, key);
+  }
+
+  // Ключом узла служит само значение: value ищется по месту и затем
+  // перемещается в узел целиком, без копии ключа
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return RBTree<Key, Key, Alloc>::insert(value, std::move(value));
+  }
+
+  // Итератор на элемент или end(); сам узел по ключу отдает RBTree::find
+  iterator find(const key_type &key) {
+    return iterator(RBTree<Key, Key, Alloc>::find(key));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    // Значение строится прямо в узле, без временного value_type
+    return RBTree<Key, Key, Alloc>::emplace(std::forward<Args>(args)...);
+  }
+
+  // Отсортированный диапазон сливается с деревом за линейное время
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    RBTree<Key, Key, Alloc>::insertRange(first, last);
+  }
+
+  // Строит сбалансированное дерево из отсортированного диапазона за O(n);
+  // повторы пропускаются, неотсортированный диапазон - std::invalid_argument
+  template <typename InputIt>
+  static Set from_sorted(InputIt first, InputIt last) {
+    Set result;
+    result.insertSorted(first, last);
+    return result;
   }
 };
 
@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
+#include <random>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -217,7 +222,7 @@ TEST(RBTreeTest, Search) {
   auto foundNode = myTree.find(2);
 
   EXPECT_NE(foundNode, nullptr);  // Узел должен быть найден
-  EXPECT_EQ(foundNode->key_, 2);
+  EXPECT_EQ(foundNode->key(), 2);
 }
 
 // Тест проверки на пустоту
@@ -317,10 +322,10 @@ TEST(SetTest, RemoveAndSize) {
 
 TEST(SetTest, Search) {
   s21::Set<int> mySet = {1, 2, 3};
-  EXPECT_TRUE(mySet.find(1));
-  EXPECT_TRUE(mySet.find(2));
-  EXPECT_TRUE(mySet.find(3));
-  EXPECT_FALSE(mySet.find(4));
+  EXPECT_EQ(*mySet.find(1), 1);
+  EXPECT_EQ(*mySet.find(2), 2);
+  EXPECT_EQ(*mySet.find(3), 3);
+  EXPECT_TRUE(mySet.find(4) == mySet.end());
 }
 
 // Тест проверки на пустоту
@@ -522,3 +527,242 @@ TEST(SetComparisonTest, Insert2) {
   // Сравнение содержимого
   EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
 }
+
+// Вставка и удаление в перемешанном порядке сохраняют балансировку дерева
+TEST(SetComparisonTest, InsertEraseShuffled) {
+  s21::Set<int> mySet;
+  std::set<int> stdSet;
+  for (int i = 0; i < 500; ++i) {
+    mySet.insert((i * 37) % 500);
+    stdSet.insert((i * 37) % 500);
+  }
+  EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
+  for (int i = 0; i < 500; i += 2) {
+    mySet.erase((i * 91) % 500);
+    stdSet.erase((i * 91) % 500);
+  }
+  EXPECT_EQ(mySet.size(), stdSet.size());
+  EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
+}
+
+TEST(SetEmplaceTest, EmplaceInPlace) {
+  s21::Set<std::string> mySet;
+  auto result = mySet.emplace(3, 'b');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "bbb");
+  auto duplicate = mySet.emplace("bbb");
+  EXPECT_FALSE(duplicate.second);
+  EXPECT_EQ(*duplicate.first, "bbb");
+  EXPECT_TRUE(mySet.insert("a").second);
+  EXPECT_EQ(mySet.size(), 2u);
+  EXPECT_EQ(*mySet.begin(), "a");
+}
+
+TEST(SetEmplaceTest, InsertRvalue) {
+  s21::Set<std::string> mySet;
+  std::string value(100, 'a');
+  EXPECT_TRUE(mySet.insert(std::move(value)).second);
+  EXPECT_TRUE(mySet.contains(std::string(100, 'a')));
+  EXPECT_FALSE(mySet.insert(std::string(100, 'a')).second);
+  EXPECT_EQ(mySet.size(), 1u);
+}
+
+// Черная высота поддерева; -1, если нарушены свойства красно-черного дерева,
+// порядок ключей или ссылки на родителя
+template <typename Node, typename Color>
+int CheckRedBlack(const Node *node, const Node *parent, Color red) {
+  if (node == nullptr) {
+    return 1;
+  }
+  if (node->parent_ != parent) {
+    return -1;
+  }
+  if (node->left_ != nullptr && !(node->left_->key() < node->key())) {
+    return -1;
+  }
+  if (node->right_ != nullptr && !(node->key() < node->right_->key())) {
+    return -1;
+  }
+  if (node->color_ == red &&
+      ((node->left_ != nullptr && node->left_->color_ == red) ||
+       (node->right_ != nullptr && node->right_->color_ == red))) {
+    return -1;
+  }
+  int left = CheckRedBlack(node->left_, node, red);
+  int right = CheckRedBlack(node->right_, node, red);
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  return left + (node->color_ == red ? 0 : 1);
+}
+
+TEST(SetTest, FromSortedBuildsValidTree) {
+  for (int n : {0, 1, 2, 3, 4, 5, 7, 8, 100, 1000, 1023, 1024}) {
+    std::vector<int> items;
+    for (int i = 0; i < n; ++i) {
+      items.push_back(i * 2);
+      if (i % 10 == 0) {
+        items.push_back(i * 2);  // повторы пропускаются
+      }
+    }
+    auto set = s21::Set<int>::from_sorted(items.begin(), items.end());
+    ASSERT_EQ(set.size(), static_cast<size_t>(n));
+    ASSERT_GT(CheckRedBlack(set.get_root(), decltype(set.get_root())(nullptr),
+                            s21::Set<int>::Color::RED),
+              0);
+    int expected = 0;
+    for (auto it = set.begin(); it != set.end(); ++it) {
+      ASSERT_EQ(*it, expected);
+      expected += 2;
+    }
+    set.insert(1);
+    ASSERT_TRUE(set.contains(1));
+    if (n > 0) {
+      set.erase(0);
+      ASSERT_FALSE(set.contains(0));
+    }
+  }
+}
+
+TEST(SetTest, FromSortedRejectsUnsortedRange) {
+  std::vector<int> items{1, 3, 2};
+  ASSERT_THROW(s21::Set<int>::from_sorted(items.begin(), items.end()),
+               std::invalid_argument);
+}
+
+TEST(SetTest, RangeInsertMergesSortedRange) {
+  s21::Set<int> set{1, 5, 9};
+  std::vector<int> sorted{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  set.insert(sorted.begin(), sorted.end());
+  ASSERT_EQ(set.size(), 11u);
+  ASSERT_GT(CheckRedBlack(set.get_root(), decltype(set.get_root())(nullptr),
+                          s21::Set<int>::Color::RED),
+            0);
+  std::vector<int> unsorted{20, 15, 30};
+  set.insert(unsorted.begin(), unsorted.end());
+  ASSERT_EQ(set.size(), 14u);
+  ASSERT_TRUE(set.contains(15));
+  std::set<int> expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 15, 20, 30};
+  auto it = set.begin();
+  for (int value : expected) {
+    ASSERT_EQ(*it, value);
+    ++it;
+  }
+}
+
+TEST(SetTest, OrderStatisticsMatchStdSet) {
+  s21::Set<int> set;
+  std::set<int> expected;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 500);
+  for (int step = 0; step < 3000; ++step) {
+    int k = key(gen);
+    if (step % 3 == 2) {
+      if (set.contains(k)) {
+        set.erase(k);
+      }
+      expected.erase(k);
+    } else {
+      set.insert(k);
+      expected.insert(k);
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  for (int k = -1; k <= 501; ++k) {
+    ASSERT_EQ(set.count(k), expected.count(k));
+    size_t less = static_cast<size_t>(
+        std::distance(expected.begin(), expected.lower_bound(k)));
+    ASSERT_EQ(set.rank(k), less);
+  }
+  size_t i = 0;
+  for (int value : expected) {
+    auto it = set.select(i);
+    ASSERT_EQ(*it, value);
+    ASSERT_EQ(set.index_of(it), i);
+    ASSERT_EQ(set.distance(set.begin(), it), i);
+    ++i;
+  }
+  ASSERT_TRUE(set.nth(set.size()) == set.end());
+  ASSERT_EQ(set.distance(set.begin(), set.end()), set.size());
+}
+
+TEST(SetTest, BoundsMatchStdSet) {
+  s21::Set<int> set{10, 20, 30, 40};
+  std::set<int> expected{10, 20, 30, 40};
+  for (int k = 5; k <= 45; k += 5) {
+    auto lower = set.lower_bound(k);
+    auto upper = set.upper_bound(k);
+    if (expected.lower_bound(k) == expected.end()) {
+      ASSERT_TRUE(lower == set.end());
+    } else {
+      ASSERT_EQ(*lower, *expected.lower_bound(k));
+    }
+    if (expected.upper_bound(k) == expected.end()) {
+      ASSERT_TRUE(upper == set.end());
+    } else {
+      ASSERT_EQ(*upper, *expected.upper_bound(k));
+    }
+    auto range = set.equal_range(k);
+    ASSERT_TRUE(range.first == lower);
+    ASSERT_TRUE(range.second == upper);
+    ASSERT_EQ(set.distance(range.first, range.second), expected.count(k));
+  }
+}
+
+TEST(SetTest, RangeViewIsHalfOpen) {
+  s21::Set<int> set;
+  for (int i = 0; i < 100; ++i) {
+    set.insert(i * 10);
+  }
+  std::vector<int> seen;
+  for (int value : set.range(95, 150)) {
+    seen.push_back(value);
+  }
+  ASSERT_EQ(seen, (std::vector<int>{100, 110, 120, 130, 140}));
+  ASSERT_TRUE(set.range(150, 95).empty());
+  ASSERT_TRUE(set.range(100, 100).empty());
+  ASSERT_TRUE(set.range(2000, 3000).empty());
+  auto tail = set.range(980, 5000);
+  ASSERT_EQ(*tail.begin(), 980);
+  ASSERT_TRUE(++tail.begin() != tail.end());
+  ASSERT_EQ(set.distance(tail.begin(), tail.end()), 2u);
+}
+
+// Значение без копирования строится прямо в узле
+TEST(SetTest, EmplaceMoveOnlyValue) {
+  s21::Set<std::unique_ptr<int>> set;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(set.emplace(std::make_unique<int>(7)).second);
+  }
+  auto moved = std::make_unique<int>(8);
+  set.insert(std::move(moved));
+  ASSERT_EQ(moved, nullptr);
+  ASSERT_EQ(set.size(), 11u);
+  for (const auto &value : set) {
+    ASSERT_TRUE(*value == 7 || *value == 8);
+  }
+}
+
+// Удаление узла с двумя детьми переставляет преемника, а не копирует его
+// значение: остальные элементы остаются на своих местах
+TEST(SetTest, EraseKeepsOtherNodesInPlace) {
+  s21::Set<int> set;
+  std::vector<const int *> address(100);
+  for (int i = 0; i < 100; ++i) {
+    set.insert(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    address[i] = &*set.find(i);
+  }
+  for (int i = 0; i < 100; i += 3) {
+    set.erase(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_TRUE(set.find(i) == set.end());
+    } else {
+      ASSERT_EQ(&*set.find(i), address[i]);
+    }
+  }
+  ASSERT_EQ(set.size(), 66u);
+}
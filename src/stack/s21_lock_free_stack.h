@@ -0,0 +1,315 @@
+#ifndef S21_LOCK_FREE_STACK_H_
+#define S21_LOCK_FREE_STACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Hazard pointers (M. Michael): before a thread dereferences a node that
+// another thread may unlink and free, it publishes the node's address in its
+// own record and re-checks that the node is still reachable. Unlinked nodes
+// are retired to a per-thread list instead of being freed; once the list is
+// long enough it is scanned and only nodes that no record points to are
+// freed. One record per thread is enough for the stack below; records are
+// claimed from the front of a fixed array, and scans only look at the part
+// that has ever been handed out.
+class HazardPointers {
+ public:
+  using Deleter = void (*)(void *);
+
+  static constexpr size_t kMaxThreads = 128;
+
+  // Publishes the current value of src as hazardous and returns it; the
+  // pointer stays safe to dereference until Clear().
+  template <typename Node>
+  static Node *Protect(const std::atomic<Node *> &src) {
+    std::atomic<const void *> &slot = Local().record_->pointer;
+    Node *ptr = src.load(std::memory_order_relaxed);
+    for (;;) {
+      slot.store(ptr);
+      Node *again = src.load();
+      if (again == ptr) {
+        return ptr;
+      }
+      ptr = again;
+    }
+  }
+
+  static void Clear() noexcept {
+    Local().record_->pointer.store(nullptr, std::memory_order_release);
+  }
+
+  // Frees ptr with deleter once no thread holds it as hazardous.
+  static void Retire(void *ptr, Deleter deleter) {
+    Holder &holder = Local();
+    holder.retired_.push_back({ptr, deleter});
+    if (holder.retired_.size() >=
+        2 * used_.load(std::memory_order_relaxed) + kMinBatch) {
+      holder.Scan();
+    }
+  }
+
+  // Frees whatever the calling thread has retired and is no longer in use.
+  static void Reclaim() { Local().Scan(); }
+
+ private:
+  static constexpr size_t kMinBatch = 64;
+
+  struct alignas(64) Record {
+    std::atomic<bool> active{false};
+    std::atomic<const void *> pointer{nullptr};
+  };
+
+  struct Retired {
+    void *ptr;
+    Deleter deleter;
+  };
+
+  // Owns one record for the lifetime of a thread. Nodes still hazardous when
+  // the thread exits are left to the next thread that scans.
+  class Holder {
+   public:
+    Holder() : record_(nullptr) {
+      for (size_t i = 0; i < kMaxThreads; ++i) {
+        bool expected = false;
+        if (records_[i].active.compare_exchange_strong(expected, true)) {
+          record_ = &records_[i];
+          size_t used = used_.load();
+          while (used <= i && !used_.compare_exchange_weak(used, i + 1)) {
+          }
+          return;
+        }
+      }
+      throw std::runtime_error("HazardPointers: too many threads");
+    }
+
+    Holder(const Holder &) = delete;
+    Holder &operator=(const Holder &) = delete;
+
+    ~Holder() {
+      record_->pointer.store(nullptr);
+      Scan();
+      if (!retired_.empty()) {
+        std::lock_guard<std::mutex> lock(orphans_mutex_);
+        orphans_.insert(orphans_.end(), retired_.begin(), retired_.end());
+      }
+      record_->active.store(false, std::memory_order_release);
+    }
+
+    void Scan() {
+      {
+        std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+        if (lock.owns_lock() && !orphans_.empty()) {
+          retired_.insert(retired_.end(), orphans_.begin(), orphans_.end());
+          orphans_.clear();
+        }
+      }
+      size_t used = used_.load();
+      std::vector<const void *> hazards;
+      hazards.reserve(used);
+      for (size_t i = 0; i < used; ++i) {
+        const void *ptr = records_[i].pointer.load();
+        if (ptr != nullptr) {
+          hazards.push_back(ptr);
+        }
+      }
+      std::sort(hazards.begin(), hazards.end());
+      auto kept = std::partition(
+          retired_.begin(), retired_.end(), [&hazards](const Retired &r) {
+            return std::binary_search(hazards.begin(), hazards.end(), r.ptr);
+          });
+      for (auto it = kept; it != retired_.end(); ++it) {
+        it->deleter(it->ptr);
+      }
+      retired_.erase(kept, retired_.end());
+    }
+
+    Record *record_;
+    std::vector<Retired> retired_;
+  };
+
+  static Holder &Local() {
+    thread_local Holder holder;
+    return holder;
+  }
+
+  static Record records_[kMaxThreads];
+  static std::atomic<size_t> used_;
+  static std::mutex orphans_mutex_;
+  static std::vector<Retired> orphans_;
+};
+
+inline HazardPointers::Record
+    HazardPointers::records_[HazardPointers::kMaxThreads];
+inline std::atomic<size_t> HazardPointers::used_{0};
+inline std::mutex HazardPointers::orphans_mutex_;
+inline std::vector<HazardPointers::Retired> HazardPointers::orphans_;
+
+// Treiber stack: push and pop are a CAS on head_, with popped nodes reclaimed
+// through HazardPointers so that a racing pop never reads freed memory (and
+// a node cannot come back under the same address mid-CAS, which rules out
+// ABA). Reclaimed nodes go to a small per-thread cache that the next push on
+// that thread takes from first, which keeps the take-and-return pattern of a
+// buffer free-list away from the allocator. Retired nodes may outlive the
+// stack, so they are freed through a default-constructed node allocator; the
+// allocator has to be always-equal.
+template <typename T, typename Alloc = std::allocator<T>>
+class LockFreeStack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using allocator_type = Alloc;
+
+  LockFreeStack() noexcept : head_(nullptr) {}
+
+  LockFreeStack(const LockFreeStack &) = delete;
+  LockFreeStack &operator=(const LockFreeStack &) = delete;
+
+  // must not race with other operations
+  ~LockFreeStack() {
+    Node *node = head_.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node *next = node->next;
+      node->Value()->~value_type();
+      FreeNode(node);
+      node = next;
+    }
+  }
+
+  void push(const_reference value) { emplace(value); }
+
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    Node *node = AllocateNode();
+    try {
+      ::new (static_cast<void *>(node->storage))
+          value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      FreeNode(node);
+      throw;
+    }
+    node->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(node->next, node,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+  }
+
+  // moves the top element into out; false if the stack was empty
+  bool try_pop(reference out) {
+    Node *node;
+    for (;;) {
+      node = HazardPointers::Protect(head_);
+      if (node == nullptr) {
+        HazardPointers::Clear();
+        return false;
+      }
+      if (head_.compare_exchange_weak(node, node->next,
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    HazardPointers::Clear();
+    value_type *value = node->Value();
+    out = std::move(*value);
+    value->~value_type();
+    HazardPointers::Retire(node, &LockFreeStack::FreeNode);
+    return true;
+  }
+
+  // a snapshot; may be stale as soon as it is returned
+  bool empty() const noexcept {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  struct Node {
+    Node *next;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  using NodeAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  static_assert(std::allocator_traits<NodeAlloc>::is_always_equal::value,
+                "LockFreeStack frees retired nodes without the stack's "
+                "allocator instance");
+
+  static constexpr size_type kCachedNodes = 256;
+
+  // Free nodes of the calling thread, linked through next. Nodes may be
+  // freed during thread exit after the cache is gone; cache_alive_ has no
+  // destructor and tells FreeNode to go to the allocator then.
+  struct NodeCache {
+    Node *head = nullptr;
+    size_type count = 0;
+
+    NodeCache() noexcept { cache_alive_ = true; }
+
+    ~NodeCache() {
+      cache_alive_ = false;
+      NodeAlloc alloc;
+      while (head != nullptr) {
+        Node *next = head->next;
+        std::allocator_traits<NodeAlloc>::deallocate(alloc, head, 1);
+        head = next;
+      }
+    }
+  };
+
+  static inline thread_local bool cache_alive_ = false;
+
+  static NodeCache &Cache() noexcept {
+    thread_local NodeCache cache;
+    return cache;
+  }
+
+  static Node *AllocateNode() {
+    NodeCache &cache = Cache();
+    if (cache.head != nullptr) {
+      Node *node = cache.head;
+      cache.head = node->next;
+      --cache.count;
+      return node;
+    }
+    NodeAlloc alloc;
+    return std::allocator_traits<NodeAlloc>::allocate(alloc, 1);
+  }
+
+  static void FreeNode(void *ptr) {
+    Node *node = static_cast<Node *>(ptr);
+    if (cache_alive_) {
+      NodeCache &cache = Cache();
+      if (cache.count < kCachedNodes) {
+        node->next = cache.head;
+        cache.head = node;
+        ++cache.count;
+        return;
+      }
+    }
+    NodeAlloc alloc;
+    std::allocator_traits<NodeAlloc>::deallocate(alloc, node, 1);
+  }
+
+  std::atomic<Node *> head_;
+};
+
+}  // namespace s21
+
+#endif  // S21_LOCK_FREE_STACK_H_
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(TestLockFreeStack, PushPopLifo) {
+  s21::LockFreeStack<std::string> s;
+  ASSERT_TRUE(s.empty());
+  s.push("a");
+  std::string b = "b";
+  s.push(b);
+  s.emplace(3, 'c');
+  std::string out;
+  ASSERT_TRUE(s.try_pop(out));
+  ASSERT_EQ(out, "ccc");
+  ASSERT_TRUE(s.try_pop(out));
+  ASSERT_EQ(out, "b");
+  ASSERT_TRUE(s.try_pop(out));
+  ASSERT_EQ(out, "a");
+  ASSERT_FALSE(s.try_pop(out));
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(TestLockFreeStack, MoveOnly) {
+  s21::LockFreeStack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(21));
+  std::unique_ptr<int> out;
+  ASSERT_TRUE(s.try_pop(out));
+  ASSERT_EQ(*out, 21);
+}
+
+TEST(TestLockFreeStack, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::LockFreeStack<std::shared_ptr<int>> s;
+    s.push(counter);
+    s.push(counter);
+    std::shared_ptr<int> out;
+    s.try_pop(out);
+    out.reset();
+    ASSERT_EQ(counter.use_count(), 2);
+  }
+  ASSERT_EQ(counter.use_count(), 1);
+  s21::HazardPointers::Reclaim();
+}
+
+// Threads take buffers from a shared free-list and put them back, the way the
+// stack is used in practice; every value must survive exactly once.
+TEST(TestLockFreeStack, StressPushPop) {
+  constexpr int kThreads = 6;
+  constexpr int kValues = 4096;
+  constexpr int kRounds = 20000;
+  s21::LockFreeStack<std::unique_ptr<int>> s;
+  for (int i = 0; i < kValues; ++i) {
+    s.push(std::make_unique<int>(i));
+  }
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&s] {
+      std::vector<std::unique_ptr<int>> taken;
+      for (int round = 0; round < kRounds; ++round) {
+        std::unique_ptr<int> buffer;
+        if (round % 4 != 3 && s.try_pop(buffer)) {
+          taken.push_back(std::move(buffer));
+        } else if (!taken.empty()) {
+          s.push(std::move(taken.back()));
+          taken.pop_back();
+        }
+      }
+      for (auto &buffer : taken) {
+        s.push(std::move(buffer));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::vector<int> seen(kValues, 0);
+  std::unique_ptr<int> buffer;
+  while (s.try_pop(buffer)) {
+    ++seen[*buffer];
+  }
+  for (int i = 0; i < kValues; ++i) {
+    ASSERT_EQ(seen[i], 1) << i;
+  }
+  s21::HazardPointers::Reclaim();
+}
@@ -1,11 +1,146 @@
 #include <iostream>
+#include <memory>
+#include <utility>
+
+#include "../vector/s21_vector.h"
 
 template <typename u>
 struct rebind {
   using other = std::allocator<u>;
 };
 
-template <typename T, typename Alloc = std::allocator<T>>
+// Политики хранения для Stack. Обе дают одинаковый набор операций:
+// emplace, pop, top, size, swap и Append (дописать копию другого хранилища
+// сверху, сохраняя порядок).
+
+// Односвязный список: по узлу на элемент, узлы берутся из Alloc.
+template <typename T, typename Alloc>
+class StackListStorage {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  StackListStorage() : count_of_elements(0), list(nullptr) {}
+  StackListStorage(const StackListStorage &s)
+      : count_of_elements(0), list(nullptr) {
+    Append(s);
+  }
+  // узлы уходят вместе с аллокатором, из которого взяты
+  StackListStorage(StackListStorage &&s)
+      : count_of_elements(s.count_of_elements),
+        alloc_node_(std::move(s.alloc_node_)),
+        list(s.list) {
+    s.list = nullptr;
+    s.count_of_elements = 0;
+  }
+  StackListStorage &operator=(const StackListStorage &s) = delete;
+  StackListStorage &operator=(StackListStorage &&s) = delete;
+
+  ~StackListStorage() {
+    while (list != nullptr) {
+      pop();
+    }
+  }
+
+  // Конструирует элемент прямо в новом узле на вершине стека
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    Node *p = std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
+    try {
+      std::allocator_traits<NodeAlloc>::construct(alloc_node_, p, list,
+                                                  std::forward<Args>(args)...);
+    } catch (...) {
+      std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, p, 1);
+      throw;
+    }
+    list = p;
+    count_of_elements++;
+    return p->data;
+  }
+
+  void pop() {
+    Node *p = list;
+    list = p->next;
+    std::allocator_traits<NodeAlloc>::destroy(alloc_node_, p);
+    std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, p, 1);
+    count_of_elements--;
+  }
+
+  const_reference top() const { return list->data; }
+  size_type size() const { return count_of_elements; }
+
+  void swap(StackListStorage &other) {
+    std::swap(alloc_node_, other.alloc_node_);
+    std::swap(list, other.list);
+    std::swap(count_of_elements, other.count_of_elements);
+  }
+
+  void Append(const StackListStorage &s) {
+    Node *current = s.list;
+    StackListStorage a;
+    while (current) {
+      a.emplace(current->data);
+      current = current->next;
+    }
+    while (a.list) {
+      emplace(a.list->data);
+      a.pop();
+    }
+  }
+
+ private:
+  typedef struct Node {
+    value_type data;
+    Node *next;
+    template <typename... Args>
+    explicit Node(Node *next_node, Args &&...args)
+        : data(std::forward<Args>(args)...), next(next_node) {}
+  } Node;
+  using NodeAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+
+  size_type count_of_elements;
+  NodeAlloc alloc_node_;
+  Node *list;
+};
+
+// Непрерывный массив на s21::Vector: вершина стека - последний элемент,
+// push и pop амортизированно O(1) без выделения памяти на каждый элемент.
+template <typename T, typename Alloc>
+class StackArrayStorage {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return items_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop() { items_.pop_back(); }
+  const_reference top() const { return items_.back(); }
+  size_type size() const { return items_.size(); }
+  void swap(StackArrayStorage &other) { items_.swap(other.items_); }
+
+  void Append(const StackArrayStorage &s) {
+    items_.reserve(items_.size() + s.items_.size());
+    for (auto it = s.items_.cbegin(); it != s.items_.cend(); ++it) {
+      items_.push_back(*it);
+    }
+  }
+
+ private:
+  s21::Vector<T, Alloc> items_;
+};
+
+// Storage выбирает представление: StackListStorage (по умолчанию) или
+// StackArrayStorage.
+template <typename T, typename Alloc = std::allocator<T>,
+          template <typename, typename> class Storage = StackListStorage>
 class Stack {
  public:
   using value_type = T;
@@ -21,7 +156,10 @@ class Stack {
   Stack &operator=(const Stack &other);
   ~Stack();
   // Основные методы
-  void push(value_type new_element);
+  void push(const_reference new_element);
+  void push(value_type &&new_element);
+  template <typename... Args>
+  reference emplace(Args &&...args);
   void pop();
   bool empty();
   void swap(Stack &other);
@@ -31,52 +169,40 @@ class Stack {
   void copy_helper(const Stack &s);
 
  private:
-  size_type count_of_elements;
-  typedef struct Node {
-    value_type data;
-    Node *next;
-  } Node;
-  using NodeAlloc =
-      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
-  NodeAlloc alloc_node_;
-  Alloc alloc;
-  Node *list;
+  Storage<T, Alloc> storage_;
 };
 
+// Стек на непрерывном массиве
+template <typename T, typename Alloc = std::allocator<T>>
+using ArrayStack = Stack<T, Alloc, StackArrayStorage>;
+
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------Конструкторы------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // Конструктор по умолчанию
-template <typename T, typename Alloc>
-Stack<T, Alloc>::Stack()
-    : count_of_elements(0), list(nullptr) {}  // Конструктор по умолчанию
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage>::Stack() : storage_() {}  // Конструктор по умолчанию
 
 // Конструктор со списком инициализации
-template <typename T, typename Alloc>
-Stack<T, Alloc>::Stack(std::initializer_list<value_type> const &items)
-    : count_of_elements(0), list(nullptr) {
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage>::Stack(std::initializer_list<value_type> const &items)
+    : storage_() {
   for (auto i = items.begin(); i < items.end(); ++i) {
     push(*i);
   }
 }
 
 // Конструктор копирования
-template <typename T, typename Alloc>
-Stack<T, Alloc>::Stack(const Stack &s) : count_of_elements(0), list(nullptr) {
-  copy_helper(s);
-}
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage>::Stack(const Stack &s) : storage_(s.storage_) {}
 
 // Конструктор перемещения
-template <typename T, typename Alloc>
-Stack<T, Alloc>::Stack(Stack &&s)
-    : count_of_elements(s.count_of_elements), list(s.list) {
-  s.list = nullptr;
-  s.count_of_elements = 0;
-}
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage>::Stack(Stack &&s) : storage_(std::move(s.storage_)) {}
 
-template <typename T, typename Alloc>
-Stack<T, Alloc> &Stack<T, Alloc>::operator=(Stack &&other) {
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage> &Stack<T, Alloc, Storage>::operator=(Stack &&other) {
   if (this != &other) {
     Stack new_stack(std::move(other));
     swap(new_stack);
@@ -85,8 +211,9 @@ Stack<T, Alloc> &Stack<T, Alloc>::operator=(Stack &&other) {
   return *this;
 }
 
-template <typename T, typename Alloc>
-Stack<T, Alloc> &Stack<T, Alloc>::operator=(const Stack &other) {
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage> &Stack<T, Alloc, Storage>::operator=(
+    const Stack &other) {
   if (this != &other) {
     while (!empty()) {
       pop();
@@ -97,66 +224,57 @@ Stack<T, Alloc> &Stack<T, Alloc>::operator=(const Stack &other) {
 }
 
 // Деструктор
-template <typename T, typename Alloc>
-Stack<T, Alloc>::~Stack() {
-  while (list != nullptr) {
-    Node *temp = list;
-    list = temp->next;
-    if (temp != nullptr && &(temp->data) != nullptr) {
-      std::allocator_traits<NodeAlloc>::destroy(alloc_node_, temp);
-      std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, temp,
-                                                   sizeof(Node));
-    }
-  }
-  count_of_elements = 0;
-}
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+Stack<T, Alloc, Storage>::~Stack() {}
 
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------Основные
 // методы---------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T, typename Alloc>
-void Stack<T, Alloc>::push(value_type new_element) {
-  Node *p = std::allocator_traits<NodeAlloc>::allocate(alloc_node_, 1);
-  p->data = new_element;
-  p->next = list;
-  list = p;
-  count_of_elements++;
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+void Stack<T, Alloc, Storage>::push(const_reference new_element) {
+  emplace(new_element);
 }
 
-template <typename T, typename Alloc>
-void Stack<T, Alloc>::pop() {
-  Node *p = list;
-  list = p->next;
-  std::allocator_traits<NodeAlloc>::destroy(alloc_node_, p);
-  std::allocator_traits<NodeAlloc>::deallocate(alloc_node_, p, sizeof(Node));
-  count_of_elements--;
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+void Stack<T, Alloc, Storage>::push(value_type &&new_element) {
+  emplace(std::move(new_element));
 }
 
-template <typename T, typename Alloc>
-bool Stack<T, Alloc>::empty() {
-  bool res = false;
-  if (list == nullptr) {
-    res = true;
-  }
-  return res;
+// Конструирует элемент прямо на вершине стека
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+template <typename... Args>
+typename Stack<T, Alloc, Storage>::reference Stack<T, Alloc, Storage>::emplace(
+    Args &&...args) {
+  return storage_.emplace(std::forward<Args>(args)...);
 }
 
-template <typename T, typename Alloc>
-void Stack<T, Alloc>::swap(Stack &other) {
-  std::swap(list, other.list);
-  std::swap(count_of_elements, other.count_of_elements);
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+void Stack<T, Alloc, Storage>::pop() {
+  storage_.pop();
 }
 
-template <typename T, typename Alloc>
-typename Stack<T, Alloc>::size_type Stack<T, Alloc>::size() const {
-  return count_of_elements;
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+bool Stack<T, Alloc, Storage>::empty() {
+  return storage_.size() == 0;
 }
 
-template <typename T, typename Alloc>
-typename Stack<T, Alloc>::const_reference Stack<T, Alloc>::top() {
-  return list->data;
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+void Stack<T, Alloc, Storage>::swap(Stack &other) {
+  storage_.swap(other.storage_);
+}
+
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+typename Stack<T, Alloc, Storage>::size_type Stack<T, Alloc, Storage>::size()
+    const {
+  return storage_.size();
+}
+
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+typename Stack<T, Alloc, Storage>::const_reference
+Stack<T, Alloc, Storage>::top() {
+  return storage_.top();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -164,16 +282,7 @@ typename Stack<T, Alloc>::const_reference Stack<T, Alloc>::top() {
 // методы---------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T, typename Alloc>
-void Stack<T, Alloc>::copy_helper(const Stack &s) {
-  Node *current = s.list;
-  Stack<size_t> a;
-  while (current) {
-    a.push(current->data);
-    current = current->next;
-  }
-  while (a.list) {
-    push(a.list->data);
-    a.pop();
-  }
+template <typename T, typename Alloc, template <typename, typename> class Storage>
+void Stack<T, Alloc, Storage>::copy_helper(const Stack &s) {
+  storage_.Append(s.storage_);
 }
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <stack>
+#include <string>
 
 #include "../s21_containers.h"
 
@@ -129,3 +131,114 @@ TEST(TestConstructor, Top) {
   std::stack<size_t> b = std::stack<size_t>({1, 2, 3, 4, 5});
   ASSERT_EQ(a.top(), b.top());
 }
+
+TEST(TestEmplace, EmplaceInPlace) {
+  Stack<std::pair<int, std::string>> s;
+  auto &ref = s.emplace(1, "one");
+  s.emplace(2, std::string(3, 'x'));
+  ASSERT_EQ(s.top().second, "xxx");
+  ASSERT_EQ(ref.second, "one");
+  ASSERT_EQ(s.size(), 2u);
+}
+
+TEST(TestEmplace, MoveOnly) {
+  Stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(1));
+  s.emplace(new int(2));
+  ASSERT_EQ(*s.top(), 2);
+  s.pop();
+  ASSERT_EQ(*s.top(), 1);
+}
+
+TEST(TestEmplace, PushRvalueMoves) {
+  Stack<std::string> s;
+  std::string value(100, 'a');
+  s.push(std::move(value));
+  ASSERT_EQ(s.top(), std::string(100, 'a'));
+  ASSERT_TRUE(value.empty());
+}
+
+TEST(TestArrayStack, PushPopOrder) {
+  ArrayStack<size_t> a;
+  std::stack<size_t> b;
+  for (size_t i = 0; i < 1000; ++i) {
+    a.push(i);
+    b.push(i);
+  }
+  ASSERT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    ASSERT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  ASSERT_TRUE(a.empty());
+}
+
+TEST(TestArrayStack, CopyMoveAssign) {
+  ArrayStack<std::string> a = {"a", "b", "c"};
+  ArrayStack<std::string> copy(a);
+  ASSERT_EQ(copy.size(), 3u);
+  ASSERT_EQ(copy.top(), "c");
+  ArrayStack<std::string> moved(std::move(a));
+  ASSERT_EQ(moved.top(), "c");
+  ASSERT_TRUE(a.empty());
+  ArrayStack<std::string> other = {"x"};
+  other = copy;
+  ASSERT_EQ(other.size(), 3u);
+  other.pop();
+  ASSERT_EQ(other.top(), "b");
+  other = std::move(moved);
+  ASSERT_EQ(other.size(), 3u);
+  ASSERT_EQ(other.top(), "c");
+}
+
+TEST(TestArrayStack, Swap) {
+  ArrayStack<size_t> a = {1, 2, 3};
+  ArrayStack<size_t> b = {4};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(a.top(), 4u);
+  ASSERT_EQ(b.size(), 3u);
+  ASSERT_EQ(b.top(), 3u);
+}
+
+TEST(TestArrayStack, EmplaceMoveOnly) {
+  Stack<std::unique_ptr<int>, std::allocator<std::unique_ptr<int>>,
+        StackArrayStorage>
+      s;
+  for (int i = 0; i < 100; ++i) {
+    s.emplace(new int(i));
+  }
+  for (int i = 99; i >= 0; --i) {
+    ASSERT_EQ(*s.top(), i);
+    s.pop();
+  }
+  ASSERT_TRUE(s.empty());
+}
+
+// Узлы остаются у того аллокатора, из пула которого взяты: перемещенный
+// стек забирает аллокатор, swap меняет их местами
+TEST(TestStackStorage, PoolAllocatorMoveAndSwap) {
+  using PoolStack = Stack<int, s21::PoolAllocator<int>>;
+  auto *a = new PoolStack{1, 2};
+  auto *b = new PoolStack(std::move(*a));
+  delete a;
+  ASSERT_EQ(b->top(), 2);
+  b->push(3);
+  PoolStack c = {4};
+  c = std::move(*b);
+  delete b;
+  ASSERT_EQ(c.size(), 3u);
+  ASSERT_EQ(c.top(), 3);
+  {
+    PoolStack d = {5, 6};
+    d.swap(c);
+    ASSERT_EQ(c.top(), 6);
+    ASSERT_EQ(d.top(), 3);
+    c.pop();
+    c.push(7);
+  }
+  ASSERT_EQ(c.top(), 7);
+  c.pop();
+  ASSERT_EQ(c.top(), 5);
+}
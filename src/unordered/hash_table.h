@@ -0,0 +1,699 @@
+#ifndef _HASH_TABLE_H_
+#define _HASH_TABLE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Control bytes of the hash table. A full slot stores the low 7 bits of its
+// hash (0..127); the other states are negative so that one signed compare
+// tells them apart.
+enum : int8_t {
+  kCtrlEmpty = -128,
+  kCtrlDeleted = -2,
+  kCtrlSentinel = -1,
+};
+
+constexpr size_t kGroupWidth = 16;
+
+// Control bytes of a table that has never allocated: a sentinel followed by
+// empties, so lookups and iteration need no capacity check.
+alignas(kGroupWidth) inline const int8_t kEmptyGroup[kGroupWidth] = {
+    kCtrlSentinel, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty};
+
+// 16 control bytes looked at together; bit i of a result mask is set when
+// byte i matches. SSE2 does each match in two instructions, the fallback
+// loops over the bytes.
+class CtrlGroup {
+ public:
+  explicit CtrlGroup(const int8_t *ctrl) {
+#if defined(__SSE2__)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+    std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+  }
+
+  uint32_t Match(int8_t h2) const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+    return MaskIf([h2](int8_t c) { return c == h2; });
+#endif
+  }
+
+  uint32_t MatchEmpty() const {
+#if defined(__SSE2__)
+    return Match(kCtrlEmpty);
+#else
+    return MaskIf([](int8_t c) { return c == kCtrlEmpty; });
+#endif
+  }
+
+  uint32_t MatchEmptyOrDeleted() const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(kCtrlSentinel), ctrl_)));
+#else
+    return MaskIf([](int8_t c) { return c < kCtrlSentinel; });
+#endif
+  }
+
+  // empty or deleted bytes before the first full byte or the sentinel
+  uint32_t CountLeadingEmptyOrDeleted() const {
+    return static_cast<uint32_t>(__builtin_ctz(~MatchEmptyOrDeleted()));
+  }
+
+ private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  template <typename Pred>
+  uint32_t MaskIf(Pred pred) const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      if (pred(ctrl_[i])) {
+        mask |= 1u << i;
+      }
+    }
+    return mask;
+  }
+
+  int8_t ctrl_[kGroupWidth];
+#endif
+};
+
+template <typename Table, bool IsConst>
+class HashTableIterator;
+
+// Open-addressing table in the layout of Swiss tables (abseil's
+// raw_hash_set). Slots live in one flat array; next to it is an array of one
+// control byte per slot, a sentinel, and a copy of the first 15 bytes, so a
+// 16-byte group can be loaded at any slot without wrapping. The capacity is
+// 2^k - 1 and the table grows at a load of 7/8. A lookup splits the hash into
+// H1, which picks where the probe starts, and H2, which is matched against a
+// whole group of control bytes at once; only slots whose byte matches have
+// their keys compared. Probing moves a group at a time along a triangular
+// sequence that visits every group.
+//
+// Erasing leaves a tombstone only when needed: if the groups around the slot
+// show that no probe ever had to pass it (an empty byte is less than a group
+// away on both sides), it becomes empty again.
+//
+// Policy supplies key_type, KeyOf(value) -> const key_type &, and
+// Transfer(alloc, dst, src), which builds the slot dst from src during a
+// rehash: by moving when kNothrowTransfer is set, by copying otherwise (as
+// std::move_if_noexcept chooses), so that src is still intact if a copy
+// throws. The hasher
+// and key_equal are stored and copied with the table, as Tree stores its
+// comparator; the allocators are default-constructed, as in Tree.
+template <typename Value, typename Policy, typename Hash, typename KeyEqual,
+          typename Alloc>
+class HashTable {
+ public:
+  using key_type = typename Policy::key_type;
+  using value_type = Value;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+  using size_type = size_t;
+  using iterator = HashTableIterator<HashTable, false>;
+  using const_iterator = HashTableIterator<HashTable, true>;
+
+  friend class HashTableIterator<HashTable, false>;
+  friend class HashTableIterator<HashTable, true>;
+
+  HashTable() noexcept(std::is_nothrow_default_constructible_v<hasher> &&
+                        std::is_nothrow_default_constructible_v<key_equal>)
+      : HashTable(hasher(), key_equal()) {}
+
+  // Starts with room for bucket_count elements and the given, possibly
+  // stateful, hasher and key_equal.
+  explicit HashTable(size_type bucket_count, const hasher &hash = hasher(),
+                     const key_equal &equal = key_equal())
+      : HashTable(hash, equal) {
+    reserve(bucket_count);
+  }
+
+  HashTable(std::initializer_list<value_type> const &items) : HashTable() {
+    reserve(items.size());
+    for (auto i = items.begin(); i != items.end(); ++i) {
+      insert(*i);
+    }
+  }
+
+  HashTable(const HashTable &other)
+      : HashTable(other.hasher_, other.key_eq_) {
+    reserve(other.size_);
+    for (auto it = other.cbegin(); it != other.cend(); ++it) {
+      insert(*it);
+    }
+  }
+
+  HashTable(HashTable &&other) noexcept(kNothrowCopyFunctors)
+      : HashTable(other.hasher_, other.key_eq_) {
+    swap(other);
+  }
+
+  HashTable &operator=(const HashTable &other) {
+    if (this != &other) {
+      HashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  HashTable &operator=(HashTable &&other) noexcept(kNothrowCopyFunctors) {
+    if (this != &other) {
+      HashTable moved(std::move(other));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  ~HashTable() { Release(); }
+
+  iterator begin() noexcept { return MakeIterator<iterator>(0).Skip(); }
+
+  iterator end() noexcept { return MakeIterator<iterator>(capacity_); }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept {
+    return MakeIterator<const_iterator>(0).Skip();
+  }
+
+  const_iterator cend() const noexcept {
+    return MakeIterator<const_iterator>(capacity_);
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::allocator_traits<SlotAlloc>::max_size(SlotAlloc());
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  float load_factor() const noexcept {
+    return capacity_ == 0 ? 0.0f
+                          : static_cast<float>(size_) /
+                                static_cast<float>(capacity_);
+  }
+
+  void clear() noexcept {
+    DestroySlots();
+    if (capacity_ != 0) {
+      std::memset(ctrl_, kCtrlEmpty, capacity_ + kGroupWidth);
+      ctrl_[capacity_] = kCtrlSentinel;
+    }
+    size_ = 0;
+    growth_left_ = MaxLoad(capacity_);
+  }
+
+  // makes room for count elements without another rehash
+  void reserve(size_type count) {
+    if (count > MaxLoad(capacity_)) {
+      Resize(CapacityFor(count));
+    }
+  }
+
+  // rebuilds the table with room for at least count elements; also drops
+  // all tombstones
+  void rehash(size_type count) {
+    size_type capacity = CapacityFor(count > size_ ? count : size_);
+    if (capacity != capacity_ || growth_left_ + size_ < MaxLoad(capacity_)) {
+      Resize(capacity);
+    }
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return EmplaceKey(Policy::KeyOf(value), value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return EmplaceKey(Policy::KeyOf(value), std::move(value));
+  }
+
+  // The key is only known once the value exists, so it is built first and
+  // moved into its slot.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return insert(std::move(value));
+  }
+
+  void erase(const_iterator pos) {
+    if (pos == cend()) {
+      return;
+    }
+    EraseAt(static_cast<size_type>(pos.ctrl_ - ctrl_));
+  }
+
+  size_type erase(const key_type &key) {
+    size_type index = FindIndex(key, HashOf(key));
+    if (index == kNotFound) {
+      return 0;
+    }
+    EraseAt(index);
+    return 1;
+  }
+
+  void swap(HashTable &other) noexcept {
+    std::swap(hasher_, other.hasher_);
+    std::swap(key_eq_, other.key_eq_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+  // moves in every element of other whose key is not here yet
+  void merge(HashTable &other) {
+    if (this == &other) {
+      return;
+    }
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (IsFull(other.ctrl_[i])) {
+        const key_type &key = Policy::KeyOf(other.slots_[i]);
+        if (!contains(key)) {
+          insert(std::move(other.slots_[i]));
+          other.EraseAt(i);
+        }
+      }
+    }
+  }
+
+  iterator find(const key_type &key) {
+    return IteratorAt<iterator>(FindIndex(key, HashOf(key)));
+  }
+
+  const_iterator find(const key_type &key) const {
+    return IteratorAt<const_iterator>(FindIndex(key, HashOf(key)));
+  }
+
+  bool contains(const key_type &key) const {
+    return FindIndex(key, HashOf(key)) != kNotFound;
+  }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  hasher hash_function() const { return hasher_; }
+
+  key_equal key_eq() const { return key_eq_; }
+
+ protected:
+  static constexpr size_type kNotFound = std::numeric_limits<size_type>::max();
+
+  // Where key is, or where it would go: found tells which. May rehash.
+  struct Probe {
+    size_type index;
+    size_t hash;
+    bool found;
+  };
+
+  Probe FindOrPrepareInsert(const key_type &key) {
+    size_t hash = HashOf(key);
+    size_type index = FindIndex(key, hash);
+    if (index != kNotFound) {
+      return {index, hash, true};
+    }
+    index = FindFirstNonFull(hash);
+    if (growth_left_ == 0 && ctrl_[index] != kCtrlDeleted) {
+      // plenty of tombstones: rebuild in place, otherwise grow
+      if (capacity_ == 0) {
+        Resize(CapacityFor(1));
+      } else if (size_ * 2 <= MaxLoad(capacity_)) {
+        Resize(capacity_);
+      } else {
+        Resize(capacity_ * 2 + 1);
+      }
+      index = FindFirstNonFull(hash);
+    }
+    return {index, hash, false};
+  }
+
+  // Builds the value in the slot a failed FindOrPrepareInsert returned.
+  template <typename... Args>
+  void ConstructAt(const Probe &probe, Args &&...args) {
+    SlotAlloc alloc;
+    std::allocator_traits<SlotAlloc>::construct(
+        alloc, slots_ + probe.index, std::forward<Args>(args)...);
+    if (ctrl_[probe.index] == kCtrlEmpty) {
+      --growth_left_;
+    }
+    SetCtrl(probe.index, H2(probe.hash));
+    ++size_;
+  }
+
+  template <typename Arg>
+  std::pair<iterator, bool> EmplaceKey(const key_type &key, Arg &&arg) {
+    Probe probe = FindOrPrepareInsert(key);
+    if (!probe.found) {
+      ConstructAt(probe, std::forward<Arg>(arg));
+    }
+    return {IteratorAt<iterator>(probe.index), !probe.found};
+  }
+
+  template <typename It>
+  It IteratorAt(size_type index) const {
+    return index == kNotFound ? MakeIterator<It>(capacity_)
+                              : MakeIterator<It>(index);
+  }
+
+  value_type &SlotAt(size_type index) noexcept { return slots_[index]; }
+
+ private:
+  using SlotAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+  using CtrlAlloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<int8_t>;
+
+  static constexpr bool kNothrowHash = noexcept(
+      std::declval<const hasher &>()(std::declval<const key_type &>()));
+
+  static constexpr bool kNothrowCopyFunctors =
+      std::is_nothrow_copy_constructible_v<hasher> &&
+      std::is_nothrow_copy_constructible_v<key_equal>;
+
+  HashTable(const hasher &hash, const key_equal &equal) noexcept(
+      kNothrowCopyFunctors)
+      : hasher_(hash),
+        key_eq_(equal),
+        ctrl_(const_cast<int8_t *>(kEmptyGroup)),
+        slots_(nullptr),
+        size_(0),
+        capacity_(0),
+        growth_left_(0) {}
+
+  static bool IsFull(int8_t ctrl) noexcept { return ctrl >= 0; }
+
+  // Scrambles the user hash, so that std::hash<int> (the identity) still
+  // spreads over H1 and H2: the murmur3 64-bit finalizer.
+  size_t HashOf(const key_type &key) const {
+    uint64_t h = static_cast<uint64_t>(hasher_(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+  }
+
+  static size_t H1(size_t hash) noexcept { return hash >> 7; }
+
+  static int8_t H2(size_t hash) noexcept {
+    return static_cast<int8_t>(hash & 0x7F);
+  }
+
+  static size_type MaxLoad(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+  // smallest 2^k - 1 (at least 15) that holds count elements at 7/8 load
+  static size_type CapacityFor(size_type count) noexcept {
+    size_type capacity = kGroupWidth - 1;
+    while (MaxLoad(capacity) < count) {
+      capacity = capacity * 2 + 1;
+    }
+    return capacity;
+  }
+
+  template <typename It>
+  It MakeIterator(size_type index) const noexcept {
+    return It(ctrl_ + index, slots_ + index);
+  }
+
+  size_type FindIndex(const key_type &key, size_t hash) const {
+    const int8_t h2 = H2(hash);
+    size_type offset = H1(hash) & capacity_;
+    size_type step = 0;
+    for (;;) {
+      CtrlGroup group(ctrl_ + offset);
+      for (uint32_t match = group.Match(h2); match != 0; match &= match - 1) {
+        size_type index =
+            (offset + static_cast<size_type>(__builtin_ctz(match))) &
+            capacity_;
+        if (key_eq_(Policy::KeyOf(slots_[index]), key)) {
+          return index;
+        }
+      }
+      if (group.MatchEmpty() != 0) {
+        return kNotFound;
+      }
+      step += kGroupWidth;
+      offset = (offset + step) & capacity_;
+    }
+  }
+
+  size_type FindFirstNonFull(size_t hash) const {
+    return FindFirstNonFull(ctrl_, capacity_, hash);
+  }
+
+  // first empty or deleted slot on the probe sequence of hash
+  static size_type FindFirstNonFull(const int8_t *ctrl, size_type capacity,
+                                    size_t hash) noexcept {
+    size_type offset = H1(hash) & capacity;
+    size_type step = 0;
+    for (;;) {
+      uint32_t mask = CtrlGroup(ctrl + offset).MatchEmptyOrDeleted();
+      if (mask != 0) {
+        return (offset + static_cast<size_type>(__builtin_ctz(mask))) &
+               capacity;
+      }
+      step += kGroupWidth;
+      offset = (offset + step) & capacity;
+    }
+  }
+
+  void SetCtrl(size_type index, int8_t value) noexcept {
+    SetCtrl(ctrl_, capacity_, index, value);
+  }
+
+  // also updates the copy of the byte past the sentinel
+  static void SetCtrl(int8_t *ctrl, size_type capacity, size_type index,
+                      int8_t value) noexcept {
+    ctrl[index] = value;
+    if (index < kGroupWidth - 1) {
+      ctrl[capacity + 1 + index] = value;
+    }
+  }
+
+  void EraseAt(size_type index) {
+    SlotAlloc alloc;
+    std::allocator_traits<SlotAlloc>::destroy(alloc, slots_ + index);
+    --size_;
+    size_type before = (index - kGroupWidth) & capacity_;
+    uint32_t empty_after = CtrlGroup(ctrl_ + index).MatchEmpty();
+    uint32_t empty_before = CtrlGroup(ctrl_ + before).MatchEmpty();
+    // no window of 16 full-or-deleted bytes covers index, so no probe for
+    // another key ever continued past it
+    bool was_never_full =
+        empty_before != 0 && empty_after != 0 &&
+        static_cast<size_type>(__builtin_ctz(empty_after) +
+                               __builtin_clz(empty_before) - 16) < kGroupWidth;
+    if (was_never_full) {
+      SetCtrl(index, kCtrlEmpty);
+      ++growth_left_;
+    } else {
+      SetCtrl(index, kCtrlDeleted);
+    }
+  }
+
+  // Fills the new arrays completely before switching to them. A hash or a
+  // copy that throws leaves the table as it was: the partial copy is
+  // destroyed and the new arrays are freed. Slots are moved only when
+  // nothing after the first move can throw.
+  void Resize(size_type capacity) {
+    CtrlAlloc ctrl_alloc;
+    SlotAlloc slot_alloc;
+    int8_t *ctrl = std::allocator_traits<CtrlAlloc>::allocate(
+        ctrl_alloc, capacity + kGroupWidth);
+    value_type *slots;
+    try {
+      slots = std::allocator_traits<SlotAlloc>::allocate(slot_alloc, capacity);
+    } catch (...) {
+      std::allocator_traits<CtrlAlloc>::deallocate(ctrl_alloc, ctrl,
+                                                   capacity + kGroupWidth);
+      throw;
+    }
+    std::memset(ctrl, kCtrlEmpty, capacity + kGroupWidth);
+    ctrl[capacity] = kCtrlSentinel;
+
+    try {
+      // a hasher that may throw runs for every slot before anything moves
+      std::unique_ptr<size_t[]> hashes;
+      if constexpr (!kNothrowHash) {
+        hashes.reset(new size_t[size_]);
+        for (size_type i = 0, n = 0; i < capacity_; ++i) {
+          if (IsFull(ctrl_[i])) {
+            hashes[n++] = HashOf(Policy::KeyOf(slots_[i]));
+          }
+        }
+      }
+      for (size_type i = 0, n = 0; i < capacity_; ++i) {
+        if (IsFull(ctrl_[i])) {
+          size_t hash;
+          if constexpr (kNothrowHash) {
+            hash = HashOf(Policy::KeyOf(slots_[i]));
+          } else {
+            hash = hashes[n++];
+          }
+          size_type index = FindFirstNonFull(ctrl, capacity, hash);
+          Policy::Transfer(slot_alloc, slots + index, slots_ + i);
+          SetCtrl(ctrl, capacity, index, H2(hash));
+          if constexpr (Policy::kNothrowTransfer) {
+            std::allocator_traits<SlotAlloc>::destroy(slot_alloc, slots_ + i);
+          }
+        }
+      }
+    } catch (...) {
+      // only hashes and copies throw, so the old slots still hold the values
+      for (size_type i = 0; i < capacity; ++i) {
+        if (IsFull(ctrl[i])) {
+          std::allocator_traits<SlotAlloc>::destroy(slot_alloc, slots + i);
+        }
+      }
+      std::allocator_traits<CtrlAlloc>::deallocate(ctrl_alloc, ctrl,
+                                                   capacity + kGroupWidth);
+      std::allocator_traits<SlotAlloc>::deallocate(slot_alloc, slots,
+                                                   capacity);
+      throw;
+    }
+
+    if constexpr (!Policy::kNothrowTransfer) {
+      DestroySlots();
+    }
+    if (capacity_ != 0) {
+      std::allocator_traits<CtrlAlloc>::deallocate(ctrl_alloc, ctrl_,
+                                                   capacity_ + kGroupWidth);
+      std::allocator_traits<SlotAlloc>::deallocate(slot_alloc, slots_,
+                                                   capacity_);
+    }
+    ctrl_ = ctrl;
+    slots_ = slots;
+    capacity_ = capacity;
+    growth_left_ = MaxLoad(capacity) - size_;
+  }
+
+  void DestroySlots() noexcept {
+    if (!std::is_trivially_destructible<value_type>::value) {
+      SlotAlloc alloc;
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (IsFull(ctrl_[i])) {
+          std::allocator_traits<SlotAlloc>::destroy(alloc, slots_ + i);
+        }
+      }
+    }
+  }
+
+  void Release() noexcept {
+    if (capacity_ == 0) {
+      return;
+    }
+    DestroySlots();
+    CtrlAlloc ctrl_alloc;
+    SlotAlloc slot_alloc;
+    std::allocator_traits<CtrlAlloc>::deallocate(ctrl_alloc, ctrl_,
+                                                 capacity_ + kGroupWidth);
+    std::allocator_traits<SlotAlloc>::deallocate(slot_alloc, slots_,
+                                                 capacity_);
+  }
+
+  hasher hasher_;
+  key_equal key_eq_;
+  int8_t *ctrl_;
+  value_type *slots_;
+  size_type size_;
+  size_type capacity_;
+  size_type growth_left_;
+};
+
+// Forward iterator over the full slots; skips a group of empty or deleted
+// bytes at a time and stops at the sentinel, which is end().
+template <typename Table, bool IsConst>
+class HashTableIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename Table::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+  using reference =
+      std::conditional_t<IsConst, const value_type &, value_type &>;
+
+  friend Table;
+  friend class HashTableIterator<Table, !IsConst>;
+
+  HashTableIterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+
+  // iterator converts to const_iterator
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  HashTableIterator(const HashTableIterator<Table, false> &other) noexcept
+      : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  HashTableIterator &operator++() {
+    ++ctrl_;
+    ++slot_;
+    return Skip();
+  }
+
+  HashTableIterator operator++(int) {
+    HashTableIterator copy(*this);
+    ++*this;
+    return copy;
+  }
+
+  bool operator==(const HashTableIterator &other) const {
+    return ctrl_ == other.ctrl_;
+  }
+
+  bool operator!=(const HashTableIterator &other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+ private:
+  HashTableIterator(const int8_t *ctrl, value_type *slot) noexcept
+      : ctrl_(ctrl), slot_(slot) {}
+
+  HashTableIterator &Skip() {
+    while (*ctrl_ < kCtrlSentinel) {
+      uint32_t shift = CtrlGroup(ctrl_).CountLeadingEmptyOrDeleted();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+    return *this;
+  }
+
+  const int8_t *ctrl_;
+  value_type *slot_;
+};
+
+}  // namespace s21
+
+#endif  // _HASH_TABLE_H_
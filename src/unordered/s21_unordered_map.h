@@ -0,0 +1,143 @@
+#ifndef _UNORDERED_MAP_H_
+#define _UNORDERED_MAP_H_
+
+#include <stdexcept>
+#include <tuple>
+
+#include "hash_table.h"
+
+namespace s21 {
+
+template <typename Key, typename T>
+struct UnorderedMapPolicy {
+  using key_type = Key;
+  static const Key &KeyOf(const std::pair<const Key, T> &value) noexcept {
+    return value.first;
+  }
+
+  static constexpr bool kNothrowTransfer =
+      std::is_nothrow_move_constructible_v<Key> &&
+      std::is_nothrow_move_constructible_v<T>;
+
+  // The key of a slot is const, which would make every rehash copy it.
+  // The source slot is destroyed right after the transfer and nothing can
+  // observe it in between, so its key is moved from, as libc++ does for
+  // the nodes of std::unordered_map. Without a noexcept move for both parts
+  // the pair is copied whole, so that a throw leaves src untouched.
+  template <typename Alloc>
+  static void Transfer(Alloc &alloc, std::pair<const Key, T> *dst,
+                       std::pair<const Key, T> *src) noexcept(
+      kNothrowTransfer) {
+    if constexpr (kNothrowTransfer) {
+      std::allocator_traits<Alloc>::construct(
+          alloc, dst, std::piecewise_construct,
+          std::forward_as_tuple(std::move(const_cast<Key &>(src->first))),
+          std::forward_as_tuple(std::move(src->second)));
+    } else {
+      std::allocator_traits<Alloc>::construct(alloc, dst,
+                                              std::move_if_noexcept(*src));
+    }
+  }
+};
+
+// Hash map on the Swiss table in hash_table.h: no ordering, one probe of
+// 16 control bytes per lookup in the common case. Member types follow
+// s21::Map; iterators and references are invalidated by any insertion that
+// rehashes.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, T>>>
+class UnorderedMap
+    : public HashTable<std::pair<const Key, T>, UnorderedMapPolicy<Key, T>,
+                       Hash, KeyEqual, Alloc> {
+  using Table = HashTable<std::pair<const Key, T>, UnorderedMapPolicy<Key, T>,
+                          Hash, KeyEqual, Alloc>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+  using iterator = typename Table::iterator;
+  using const_iterator = typename Table::const_iterator;
+  using size_type = size_t;
+
+  using Table::Table;
+  using Table::insert;
+
+  T &at(const Key &key) {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("error");
+    }
+    return (*it).second;
+  }
+
+  const T &at(const Key &key) const {
+    auto it = this->find(key);
+    if (it == this->cend()) {
+      throw std::out_of_range("error");
+    }
+    return (*it).second;
+  }
+
+  T &operator[](const key_type &key) {
+    auto probe = this->FindOrPrepareInsert(key);
+    if (!probe.found) {
+      this->ConstructAt(probe, std::piecewise_construct,
+                        std::forward_as_tuple(key), std::forward_as_tuple());
+    }
+    return this->SlotAt(probe.index).second;
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return TryEmplace(key, obj);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto result = TryEmplace(key, obj);
+    if (!result.second) {
+      (*result.first).second = obj;
+    }
+    return result;
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             mapped_type &&obj) {
+    auto result = TryEmplace(key, std::move(obj));
+    if (!result.second) {
+      (*result.first).second = std::move(obj);
+    }
+    return result;
+  }
+
+  // builds the mapped value only if key is absent
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+ private:
+  template <typename... Args>
+  std::pair<iterator, bool> TryEmplace(const key_type &key, Args &&...args) {
+    auto probe = this->FindOrPrepareInsert(key);
+    if (!probe.found) {
+      this->ConstructAt(probe, std::piecewise_construct,
+                        std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    return {this->template IteratorAt<iterator>(probe.index), !probe.found};
+  }
+};
+
+}  // namespace s21
+
+#endif  // _UNORDERED_MAP_H_
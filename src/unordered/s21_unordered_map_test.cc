@@ -0,0 +1,313 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+// Keys equal modulo mod. Neither functor has a default constructor, so the
+// table can only use the instances it was given; the hasher also counts its
+// calls through a pointer owned by the test.
+struct ModHash {
+  size_t mod;
+  int *calls;
+  size_t operator()(int key) const {
+    ++*calls;
+    return std::hash<int>()(key % static_cast<int>(mod));
+  }
+};
+
+struct ModEqual {
+  int mod;
+  bool operator()(int a, int b) const { return a % mod == b % mod; }
+};
+
+// Counts its copies; the copy throws once throw_after more copies have been
+// made. With NothrowMove false the table has to copy it when rehashing.
+template <bool NothrowMove>
+struct CountedKey {
+  static inline int copies = 0;
+  static inline int throw_after = -1;
+  int value;
+  explicit CountedKey(int value) : value(value) {}
+  CountedKey(const CountedKey &other) : value(other.value) {
+    if (throw_after == 0) {
+      throw std::runtime_error("copy");
+    }
+    if (throw_after > 0) {
+      --throw_after;
+    }
+    ++copies;
+  }
+  CountedKey(CountedKey &&other) noexcept(NothrowMove) : value(other.value) {}
+  bool operator==(const CountedKey &other) const {
+    return value == other.value;
+  }
+};
+
+// Throws on the call after throw_after more calls.
+struct ThrowingHash {
+  static inline int throw_after = -1;
+  size_t operator()(int key) const {
+    if (throw_after == 0) {
+      throw std::runtime_error("hash");
+    }
+    if (throw_after > 0) {
+      --throw_after;
+    }
+    return std::hash<int>()(key);
+  }
+};
+
+struct CountedKeyHash {
+  template <bool NothrowMove>
+  size_t operator()(const CountedKey<NothrowMove> &key) const noexcept {
+    return std::hash<int>()(key.value);
+  }
+};
+
+// Fills m to the last element its capacity of 31 holds, so the next insert
+// rehashes.
+template <typename Map, typename MakeKey>
+void FillToRehash(Map &m, MakeKey make_key) {
+  for (int i = 0; i < 28; ++i) {
+    m.insert(make_key(i), i);
+  }
+  ASSERT_EQ(m.capacity(), 31u);
+}
+
+template <typename Map, typename MakeKey>
+void ExpectIntact(const Map &m, MakeKey make_key) {
+  ASSERT_EQ(m.size(), 28u);
+  ASSERT_EQ(m.capacity(), 31u);
+  size_t iterated = 0;
+  for (auto it = m.cbegin(); it != m.cend(); ++it) {
+    ++iterated;
+  }
+  ASSERT_EQ(iterated, 28u);
+  for (int i = 0; i < 28; ++i) {
+    ASSERT_EQ(m.at(make_key(i)), i);
+  }
+}
+
+}  // namespace
+
+TEST(TestUnorderedMap, DefaultIsEmpty) {
+  s21::UnorderedMap<int, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.size(), 0u);
+  ASSERT_EQ(m.capacity(), 0u);
+  ASSERT_TRUE(m.begin() == m.end());
+  ASSERT_FALSE(m.contains(1));
+  ASSERT_TRUE(m.find(1) == m.end());
+  ASSERT_EQ(m.erase(1), 0u);
+}
+
+TEST(TestUnorderedMap, InsertFindAt) {
+  s21::UnorderedMap<int, std::string> m{{1, "one"}, {2, "two"}};
+  ASSERT_EQ(m.size(), 2u);
+  auto result = m.insert({3, "three"});
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ((*result.first).second, "three");
+  result = m.insert(3, "drei");
+  ASSERT_FALSE(result.second);
+  ASSERT_EQ(result.first->second, "three");
+  ASSERT_EQ(m.at(2), "two");
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  ASSERT_EQ(m.count(1), 1u);
+  ASSERT_EQ(m.count(4), 0u);
+  const auto &cm = m;
+  ASSERT_EQ(cm.find(1)->second, "one");
+  ASSERT_TRUE(cm.find(4) == cm.cend());
+}
+
+TEST(TestUnorderedMap, SubscriptAndAssign) {
+  s21::UnorderedMap<std::string, int> m;
+  m["a"] = 1;
+  ++m["a"];
+  ++m["b"];
+  ASSERT_EQ(m["a"], 2);
+  ASSERT_EQ(m["b"], 1);
+  ASSERT_FALSE(m.insert_or_assign("a", 10).second);
+  ASSERT_TRUE(m.insert_or_assign("c", 3).second);
+  ASSERT_EQ(m.at("a"), 10);
+  ASSERT_FALSE(m.try_emplace("c", 7).second);
+  ASSERT_EQ(m.at("c"), 3);
+  ASSERT_TRUE(m.emplace("d", 4).second);
+  ASSERT_EQ(m.size(), 4u);
+}
+
+TEST(TestUnorderedMap, MoveOnlyValues) {
+  s21::UnorderedMap<int, std::unique_ptr<int>> m;
+  for (int i = 0; i < 100; ++i) {
+    m.try_emplace(i, new int(i));
+  }
+  m.insert_or_assign(5, std::make_unique<int>(50));
+  ASSERT_EQ(*m.at(5), 50);
+  ASSERT_EQ(*m.at(99), 99);
+  s21::UnorderedMap<int, std::unique_ptr<int>> moved(std::move(m));
+  ASSERT_EQ(moved.size(), 100u);
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(TestUnorderedMap, GrowsAndIteratesEveryElement) {
+  s21::UnorderedMap<int, int> m;
+  for (int i = 0; i < 10000; ++i) {
+    m.insert(i, i * 3);
+  }
+  ASSERT_EQ(m.size(), 10000u);
+  ASSERT_LE(m.load_factor(), 0.875f);
+  long long sum = 0;
+  size_t seen = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_EQ(it->second, it->first * 3);
+    sum += it->first;
+    ++seen;
+  }
+  ASSERT_EQ(seen, 10000u);
+  ASSERT_EQ(sum, 9999LL * 10000 / 2);
+}
+
+TEST(TestUnorderedMap, EraseByIteratorAndKey) {
+  s21::UnorderedMap<int, int> m;
+  for (int i = 0; i < 1000; ++i) {
+    m.insert(i, i);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_EQ(m.erase(i), 1u);
+  }
+  m.erase(m.find(1));
+  m.erase(m.end());
+  ASSERT_EQ(m.size(), 499u);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(m.contains(i), i % 2 == 1 && i != 1);
+  }
+}
+
+// Random inserts and erases against std::unordered_map, long enough to go
+// through tombstone reuse and in-place rehashes.
+TEST(TestUnorderedMap, MatchesStdUnderChurn) {
+  s21::UnorderedMap<int, int> m;
+  std::unordered_map<int, int> expected;
+  std::mt19937 rng(21);
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int step = 0; step < 200000; ++step) {
+    int k = key(rng);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), expected.erase(k));
+    } else {
+      m.insert_or_assign(k, step);
+      expected[k] = step;
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  for (const auto &kv : expected) {
+    ASSERT_EQ(m.at(kv.first), kv.second);
+  }
+  m.rehash(0);
+  ASSERT_EQ(m.size(), expected.size());
+  for (const auto &kv : expected) {
+    ASSERT_EQ(m.at(kv.first), kv.second);
+  }
+}
+
+TEST(TestUnorderedMap, CopySwapMergeClear) {
+  s21::UnorderedMap<int, int> a{{1, 1}, {2, 2}};
+  s21::UnorderedMap<int, int> b(a);
+  b[3] = 3;
+  ASSERT_EQ(a.size(), 2u);
+  ASSERT_EQ(b.size(), 3u);
+  a = b;
+  ASSERT_EQ(a.size(), 3u);
+  s21::UnorderedMap<int, int> c{{3, 30}, {4, 40}};
+  a.merge(c);
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.at(3), 3);
+  ASSERT_EQ(c.size(), 1u);
+  ASSERT_EQ(c.at(3), 30);
+  a.swap(c);
+  ASSERT_EQ(a.size(), 1u);
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_TRUE(c.begin() == c.end());
+  c[7] = 7;
+  ASSERT_EQ(c.at(7), 7);
+}
+
+TEST(TestUnorderedMap, ReserveAvoidsRehash) {
+  s21::UnorderedMap<int, int> m;
+  m.reserve(1000);
+  size_t capacity = m.capacity();
+  ASSERT_GE(capacity, 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    m.insert(i, i);
+  }
+  ASSERT_EQ(m.capacity(), capacity);
+}
+
+TEST(TestUnorderedMap, StatefulHashAndKeyEqual) {
+  int calls = 0;
+  using ModMap = s21::UnorderedMap<int, int, ModHash, ModEqual>;
+  ModMap m(4, ModHash{10, &calls}, ModEqual{10});
+  ASSERT_GE(m.capacity(), 4u);
+  m.insert(3, 30);
+  ASSERT_FALSE(m.insert(13, 130).second);
+  ASSERT_EQ(m.at(23), 30);
+  ASSERT_GT(calls, 0);
+  // rehashing keeps using the same functors
+  for (int i = 0; i < 1000; ++i) {
+    m.insert(i, i);
+  }
+  ASSERT_EQ(m.size(), 10u);
+  ASSERT_EQ(m.hash_function().mod, 10u);
+  ASSERT_EQ(m.key_eq().mod, 10);
+  ModMap copy(m);
+  ASSERT_TRUE(copy.contains(33));
+  ModMap moved(std::move(copy));
+  ASSERT_EQ(moved.at(47), 7);
+  ModMap other(0, ModHash{2, &calls}, ModEqual{2});
+  other.insert(1, 1);
+  other.swap(moved);
+  ASSERT_EQ(other.size(), 10u);
+  ASSERT_TRUE(moved.contains(5));
+  ASSERT_EQ(moved.key_eq().mod, 2);
+}
+
+TEST(TestUnorderedMap, RehashThatThrowsKeepsTheTable) {
+  using Key = CountedKey<false>;
+  auto make_key = [](int i) { return Key(i); };
+  s21::UnorderedMap<Key, int, CountedKeyHash> m;
+  FillToRehash(m, make_key);
+  Key::throw_after = 10;
+  ASSERT_THROW(m.insert(Key(28), 28), std::runtime_error);
+  Key::throw_after = -1;
+  ExpectIntact(m, make_key);
+  m.insert(Key(28), 28);
+  ASSERT_EQ(m.capacity(), 63u);
+  ASSERT_EQ(m.at(Key(28)), 28);
+
+  auto same = [](int i) { return i; };
+  s21::UnorderedMap<int, int, ThrowingHash> hashed;
+  FillToRehash(hashed, same);
+  ThrowingHash::throw_after = 10;
+  ASSERT_THROW(hashed.insert(28, 28), std::runtime_error);
+  ThrowingHash::throw_after = -1;
+  ExpectIntact(hashed, same);
+}
+
+TEST(TestUnorderedMap, RehashMovesKeys) {
+  using Key = CountedKey<true>;
+  s21::UnorderedMap<Key, int, CountedKeyHash> m;
+  Key::copies = 0;
+  for (int i = 0; i < 1000; ++i) {
+    m.insert(Key(i), i);
+  }
+  // one copy into the slot per insert, none for the seven rehashes
+  ASSERT_EQ(Key::copies, 1000);
+  ASSERT_EQ(m.at(Key(999)), 999);
+}
@@ -0,0 +1,70 @@
+#ifndef _UNORDERED_SET_H_
+#define _UNORDERED_SET_H_
+
+#include "hash_table.h"
+
+namespace s21 {
+
+template <typename Key>
+struct UnorderedSetPolicy {
+  using key_type = Key;
+  static const Key &KeyOf(const Key &value) noexcept { return value; }
+
+  static constexpr bool kNothrowTransfer =
+      std::is_nothrow_move_constructible_v<Key>;
+
+  template <typename Alloc>
+  static void Transfer(Alloc &alloc, Key *dst,
+                       Key *src) noexcept(kNothrowTransfer) {
+    std::allocator_traits<Alloc>::construct(alloc, dst,
+                                            std::move_if_noexcept(*src));
+  }
+};
+
+// Hash set on the Swiss table in hash_table.h. Elements are immutable
+// through iterators, as in s21::Set.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Alloc = std::allocator<Key>>
+class UnorderedSet
+    : public HashTable<Key, UnorderedSetPolicy<Key>, Hash, KeyEqual, Alloc> {
+  using Table = HashTable<Key, UnorderedSetPolicy<Key>, Hash, KeyEqual, Alloc>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = Key &;
+  using const_reference = const Key &;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+  using iterator = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+  using size_type = size_t;
+
+  using Table::Table;
+
+  iterator begin() const noexcept { return Table::cbegin(); }
+  iterator end() const noexcept { return Table::cend(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return Table::insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return Table::insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return Table::emplace(std::forward<Args>(args)...);
+  }
+
+  iterator find(const key_type &key) const { return Table::find(key); }
+
+  using Table::erase;
+};
+
+}  // namespace s21
+
+#endif  // _UNORDERED_SET_H_
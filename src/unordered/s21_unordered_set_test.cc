@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../s21_containersplus.h"
+
+TEST(TestUnorderedSet, InsertContainsErase) {
+  s21::UnorderedSet<std::string> s{"a", "b", "c"};
+  ASSERT_EQ(s.size(), 3u);
+  ASSERT_FALSE(s.insert("a").second);
+  ASSERT_TRUE(s.insert(std::string("d")).second);
+  ASSERT_TRUE(s.emplace(2, 'e').second);
+  ASSERT_TRUE(s.contains("ee"));
+  ASSERT_EQ(*s.find("d"), "d");
+  ASSERT_TRUE(s.find("z") == s.end());
+  ASSERT_EQ(s.erase("a"), 1u);
+  s.erase(s.find("b"));
+  ASSERT_EQ(s.size(), 3u);
+  ASSERT_FALSE(s.contains("a"));
+  ASSERT_FALSE(s.contains("b"));
+}
+
+TEST(TestUnorderedSet, IteratesEveryElementOnce) {
+  s21::UnorderedSet<int> s;
+  for (int i = 0; i < 5000; ++i) {
+    s.insert(i * 7);
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    s.erase(i * 7);
+  }
+  size_t seen = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    ASSERT_EQ(*it % 7, 0);
+    ASSERT_NE((*it / 7) % 3, 0);
+    ++seen;
+  }
+  ASSERT_EQ(seen, s.size());
+}
+
+TEST(TestUnorderedSet, CopyAndMove) {
+  s21::UnorderedSet<int> a{1, 2, 3};
+  s21::UnorderedSet<int> b(a);
+  b.insert(4);
+  s21::UnorderedSet<int> c(std::move(b));
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_EQ(c.size(), 4u);
+  ASSERT_TRUE(b.empty());
+  a = std::move(c);
+  ASSERT_TRUE(a.contains(4));
+}
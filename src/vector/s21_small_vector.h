@@ -0,0 +1,129 @@
+#ifndef _SMALL_VECTOR_H_
+#define _SMALL_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Raw inline storage for N elements. Kept in a base class placed before
+// Vector, so the buffer exists by the time Vector is constructed on it and
+// is still there when Vector destroys its elements.
+template <typename T, size_t N>
+class SmallVectorStorage {
+ protected:
+  T *InlineBuffer() noexcept { return reinterpret_cast<T *>(buffer_); }
+
+ private:
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+// Vector that keeps up to N elements inline and only goes to the heap once it
+// grows past N. It has the Vector interface and iterators, but Vector is a
+// protected base: a SmallVector cannot be deleted through a Vector pointer nor
+// moved through a Vector &&, whose noexcept move cannot relocate inline
+// elements. as_vector() gives a read-only Vector view where one is needed.
+template <typename T, size_t N, typename Alloc = std::allocator<T>>
+class SmallVector : private SmallVectorStorage<T, N>,
+                    protected Vector<T, Alloc> {
+  static_assert(N > 0, "SmallVector needs room for at least one element");
+
+ public:
+  using base = Vector<T, Alloc>;
+  using value_type = typename base::value_type;
+  using reference = typename base::reference;
+  using const_reference = typename base::const_reference;
+  using pointer = typename base::pointer;
+  using const_pointer = typename base::const_pointer;
+  using iterator = typename base::iterator;
+  using const_iterator = typename base::const_iterator;
+  using size_type = typename base::size_type;
+
+  using base::at;
+  using base::back;
+  using base::begin;
+  using base::capacity;
+  using base::cbegin;
+  using base::cend;
+  using base::clear;
+  using base::data;
+  using base::emplace;
+  using base::emplace_back;
+  using base::empty;
+  using base::end;
+  using base::erase;
+  using base::front;
+  using base::insert;
+  using base::max_size;
+  using base::pop_back;
+  using base::push_back;
+  using base::reserve;
+  using base::resize;
+  using base::shrink_to_fit;
+  using base::size;
+  using base::operator[];
+
+  static constexpr size_type inline_capacity = N;
+
+  SmallVector() noexcept : base(this->InlineBuffer(), N) {}
+
+  explicit SmallVector(size_type count) : SmallVector() {
+    this->insert(this->end(), count, value_type());
+  }
+
+  SmallVector(std::initializer_list<value_type> const &items) : SmallVector() {
+    this->insert(this->end(), items.begin(), items.end());
+  }
+
+  SmallVector(const SmallVector &other) : SmallVector() {
+    this->insert(this->end(), other.cbegin(), other.cend());
+  }
+
+  explicit SmallVector(const base &other) : SmallVector() {
+    this->insert(this->end(), other.cbegin(), other.cend());
+  }
+
+  // Inline elements are moved one by one into this inline buffer, which has
+  // the same room, so only a throwing move of T can make this throw.
+  SmallVector(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : SmallVector() {
+    this->TakeStorage(std::move(other));
+  }
+
+  // other may be a larger SmallVector whose inline elements need a new
+  // allocation here.
+  explicit SmallVector(base &&other) : SmallVector() {
+    this->TakeStorage(std::move(other));
+  }
+
+  SmallVector &operator=(const SmallVector &other) {
+    base::operator=(other);
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      this->ResetStorage();
+      this->TakeStorage(std::move(other));
+    }
+    return *this;
+  }
+
+  ~SmallVector() = default;
+
+  void swap(SmallVector &other) { base::swap(other); }
+  void swap(base &other) { base::swap(other); }
+
+  const base &as_vector() const noexcept { return *this; }
+
+  // true while the elements live in the inline buffer
+  bool is_small() const noexcept { return this->IsSmall(); }
+
+ private:
+  // Vector(SmallVector &&) takes the elements through the base
+  friend base;
+};
+
+};      // namespace s21
+#endif  //_SMALL_VECTOR_H_
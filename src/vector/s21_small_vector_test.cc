@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+template <typename V>
+bool DataIsInline(V &v) {
+  const char *data = reinterpret_cast<const char *>(v.data());
+  const char *self = reinterpret_cast<const char *>(&v);
+  return data >= self && data < self + sizeof(v);
+}
+
+int Sum(const s21::Vector<int> &v) {
+  int sum = 0;
+  for (auto it = v.cbegin(); it != v.cend(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+// Copyable, with a move that may throw, so relocation copies it; the copy
+// throws while armed is set.
+struct ThrowingCopy {
+  static inline bool armed = false;
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy &) {
+    if (armed) {
+      throw std::runtime_error("copy");
+    }
+  }
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+
+}  // namespace
+
+TEST(TestSmallVector, DefaultIsInline) {
+  s21::SmallVector<int, 4> V;
+  ASSERT_TRUE(V.empty());
+  ASSERT_EQ(V.size(), 0u);
+  ASSERT_EQ(V.capacity(), 4u);
+  ASSERT_TRUE(V.is_small());
+}
+
+TEST(TestSmallVector, SpillsPastN) {
+  s21::SmallVector<int, 4> V;
+  for (int i = 0; i < 4; ++i) {
+    V.push_back(i);
+  }
+  ASSERT_TRUE(V.is_small());
+  ASSERT_TRUE(DataIsInline(V));
+  V.push_back(4);
+  ASSERT_FALSE(V.is_small());
+  ASSERT_FALSE(DataIsInline(V));
+  ASSERT_EQ(V.size(), 5u);
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(V[i], i);
+  }
+}
+
+TEST(TestSmallVector, Constructors) {
+  s21::SmallVector<std::string, 3> V = {"a", "b"};
+  ASSERT_EQ(V.size(), 2u);
+  ASSERT_TRUE(V.is_small());
+  s21::SmallVector<int, 2> V2(5);
+  ASSERT_EQ(V2.size(), 5u);
+  ASSERT_EQ(V2.at(4), 0);
+  s21::Vector<int> plain = {1, 2};
+  s21::SmallVector<int, 2> V3(plain);
+  ASSERT_TRUE(V3.is_small());
+  ASSERT_EQ(V3.at(1), 2);
+}
+
+TEST(TestSmallVector, Copy) {
+  s21::SmallVector<std::string, 2> small = {"x"};
+  s21::SmallVector<std::string, 2> big = {"a", "b", "c"};
+  s21::SmallVector<std::string, 2> copy_small(small);
+  s21::SmallVector<std::string, 2> copy_big(big);
+  ASSERT_TRUE(copy_small.is_small());
+  ASSERT_EQ(copy_small.at(0), "x");
+  ASSERT_EQ(copy_big.size(), 3u);
+  ASSERT_EQ(copy_big.at(2), "c");
+  copy_small = big;
+  ASSERT_EQ(copy_small.size(), 3u);
+  copy_big = small;
+  ASSERT_EQ(copy_big.size(), 1u);
+  ASSERT_EQ(copy_big.at(0), "x");
+}
+
+TEST(TestSmallVector, MoveInline) {
+  s21::SmallVector<std::string, 4> V = {"one", "two"};
+  s21::SmallVector<std::string, 4> moved(std::move(V));
+  ASSERT_TRUE(moved.is_small());
+  ASSERT_EQ(moved.size(), 2u);
+  ASSERT_EQ(moved.at(1), "two");
+  ASSERT_TRUE(V.empty());
+  V.push_back("again");
+  ASSERT_TRUE(V.is_small());
+  ASSERT_EQ(V.at(0), "again");
+}
+
+TEST(TestSmallVector, MoveHeapStealsBuffer) {
+  s21::SmallVector<int, 2> V = {1, 2, 3, 4};
+  int *data = V.data();
+  s21::SmallVector<int, 2> moved(std::move(V));
+  ASSERT_EQ(moved.data(), data);
+  ASSERT_TRUE(V.empty());
+  ASSERT_TRUE(V.is_small());
+  ASSERT_EQ(V.capacity(), 2u);
+}
+
+TEST(TestSmallVector, MoveAssignment) {
+  s21::SmallVector<std::string, 2> a = {"a"};
+  s21::SmallVector<std::string, 2> b = {"b", "b", "b"};
+  a = std::move(b);
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_FALSE(a.is_small());
+  ASSERT_TRUE(b.empty());
+  s21::SmallVector<std::string, 2> c = {"c"};
+  a = std::move(c);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_TRUE(a.is_small());
+  ASSERT_EQ(a.at(0), "c");
+}
+
+TEST(TestSmallVector, MoveToPlainVector) {
+  s21::SmallVector<std::string, 4> V = {"a", "b"};
+  s21::Vector<std::string> plain(std::move(V));
+  ASSERT_EQ(plain.size(), 2u);
+  ASSERT_EQ(plain.at(1), "b");
+  ASSERT_TRUE(V.empty());
+  s21::SmallVector<std::string, 4> back(std::move(plain));
+  ASSERT_EQ(back.size(), 2u);
+  ASSERT_FALSE(back.is_small());
+}
+
+TEST(TestSmallVector, MoveThatRelocatesIsNotNoexcept) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::Vector<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::Vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::SmallVector<int, 4>>);
+  static_assert(!std::is_nothrow_constructible_v<s21::Vector<int>,
+                                                 s21::SmallVector<int, 4> &&>);
+  static_assert(!std::is_nothrow_assignable_v<s21::Vector<int> &,
+                                              s21::SmallVector<int, 4> &&>);
+  static_assert(
+      !std::is_nothrow_move_constructible_v<s21::SmallVector<ThrowingCopy, 4>>);
+  using Small = s21::SmallVector<ThrowingCopy, 4>;
+  Small V(2);
+  s21::Vector<ThrowingCopy> target(1);
+  ThrowingCopy::armed = true;
+  ASSERT_THROW(s21::Vector<ThrowingCopy> plain(std::move(V)),
+               std::runtime_error);
+  ASSERT_THROW(Small moved(std::move(V)), std::runtime_error);
+  ASSERT_THROW(target = std::move(V), std::runtime_error);
+  ASSERT_TRUE(target.empty());
+  ThrowingCopy::armed = false;
+  ASSERT_EQ(V.size(), 2u);
+}
+
+TEST(TestSmallVector, Swap) {
+  s21::SmallVector<int, 4> a = {1, 2};
+  s21::SmallVector<int, 4> b = {3, 4, 5};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_EQ(a.at(2), 5);
+  ASSERT_EQ(b.size(), 2u);
+  ASSERT_EQ(b.at(1), 2);
+  ASSERT_TRUE(a.is_small());
+  ASSERT_TRUE(b.is_small());
+  s21::Vector<int> plain = {7, 8, 9, 10, 11, 12};
+  a.swap(plain);
+  ASSERT_EQ(a.size(), 6u);
+  ASSERT_EQ(a.at(5), 12);
+  ASSERT_EQ(plain.size(), 3u);
+  ASSERT_EQ(plain.at(0), 3);
+}
+
+TEST(TestSmallVector, ReadOnlyVectorView) {
+  // Vector is not a public base: no Vector & to move from, no Vector * to
+  // delete through
+  static_assert(!std::is_convertible_v<s21::SmallVector<int, 4> *,
+                                       s21::Vector<int> *>);
+  static_assert(!std::is_convertible_v<s21::SmallVector<int, 4> &,
+                                       s21::Vector<int> &>);
+  static_assert(
+      std::is_same_v<decltype(std::declval<s21::SmallVector<int, 4> &>()
+                                  .as_vector()),
+                     const s21::Vector<int> &>);
+  s21::SmallVector<int, 4> V;
+  for (int i = 0; i < 10; ++i) {
+    V.push_back(i);
+  }
+  ASSERT_EQ(Sum(V.as_vector()), 45);
+  V.erase(V.begin());
+  ASSERT_EQ(V.at(0), 1);
+  ASSERT_EQ(V.as_vector().size(), 9u);
+}
+
+TEST(TestSmallVector, ShrinkBackInline) {
+  s21::SmallVector<std::string, 4> V = {"a", "b", "c", "d", "e"};
+  ASSERT_FALSE(V.is_small());
+  V.pop_back();
+  V.shrink_to_fit();
+  ASSERT_TRUE(V.is_small());
+  ASSERT_EQ(V.size(), 4u);
+  ASSERT_EQ(V.at(3), "d");
+}
+
+TEST(TestSmallVector, InsertEraseMiddle) {
+  s21::SmallVector<int, 8> V = {1, 4};
+  auto pos = V.begin();
+  pos++;
+  std::vector<int> items = {2, 3};
+  V.insert(pos, items.begin(), items.end());
+  std::vector<int> expected = {1, 2, 3, 4};
+  ASSERT_EQ(V.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(V.at(i), expected[i]);
+  }
+  auto first = V.begin();
+  first++;
+  auto last = first;
+  last++;
+  last++;
+  V.erase(first, last);
+  ASSERT_EQ(V.size(), 2u);
+  ASSERT_EQ(V.at(1), 4);
+  ASSERT_TRUE(V.is_small());
+}
+
+TEST(TestSmallVector, EmplaceOwnElementOnSpill) {
+  s21::SmallVector<std::string, 2> V = {"first", "second"};
+  V.emplace_back(V[0]);
+  ASSERT_FALSE(V.is_small());
+  ASSERT_EQ(V.at(2), "first");
+}
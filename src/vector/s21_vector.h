@@ -1,14 +1,22 @@
 #ifndef _VECTOR_H_
 #define _VECTOR_H_
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
 
 namespace s21 {
 
 template <typename T, bool IsConst>
 class CommonIterator;
 
+template <typename T, size_t N, typename Alloc>
+class SmallVector;
+
 template <typename T, typename Alloc = std::allocator<T>>
 class Vector {
  public:
@@ -51,22 +59,36 @@ class Vector {
     }
   };
 
+  // The heap buffer of a plain Vector is taken over as is. A SmallVector goes
+  // through the overloads below instead, so these never relocate elements.
   Vector(Vector &&v) noexcept
-      : array_(v.array_), size_(v.size_), capacity_(v.capacity_) {
-    v.array_ = nullptr;
-    v.size_ = 0;
-    v.capacity_ = 0;
+      : array_(nullptr), size_(0), capacity_(0) {
+    TakeStorage(std::move(v));
   };
 
   Vector &operator=(Vector &&v) noexcept {
     if (this != &v) {
-      clear();
-      Vector new_vector(std::move(v));
-      swap(new_vector);
+      ResetStorage();
+      TakeStorage(std::move(v));
     }
     return *this;
   };
 
+  // Elements kept in the inline buffer of a SmallVector are moved one by one
+  // into a new allocation, which may throw.
+  template <size_t N>
+  Vector(SmallVector<T, N, Alloc> &&v)
+      : array_(nullptr), size_(0), capacity_(0) {
+    TakeStorage(std::move(v));
+  }
+
+  template <size_t N>
+  Vector &operator=(SmallVector<T, N, Alloc> &&v) {
+    ResetStorage();
+    TakeStorage(std::move(v));
+    return *this;
+  }
+
   Vector &operator=(const Vector &v) {
     if (this != &v) {
       if (v.capacity() < capacity_) {
@@ -119,6 +141,8 @@ class Vector {
       return array_;
   };
 
+  const_pointer data() const noexcept { return array_; }
+
   iterator begin() noexcept { return iterator(array_); };
 
   iterator end() noexcept { return iterator(array_ + size_); };
@@ -129,13 +153,7 @@ class Vector {
     return const_iterator(array_ + size_);
   };
 
-  bool empty() const noexcept {
-    bool result = false;
-    if (array_ == nullptr) {
-      result = true;
-    }
-    return result;
-  };
+  bool empty() const noexcept { return size_ == 0; };
 
   size_type size() const noexcept { return size_; };
 
@@ -154,10 +172,20 @@ class Vector {
   size_type capacity() const noexcept { return capacity_; };
 
   void shrink_to_fit() {
-    if (capacity_ == size_) {
+    if (capacity_ == size_ || IsSmall()) {
       return;
     }
-    ThrowFunction(size_, capacity_);
+    if (size_ <= small_capacity_) {
+      // fits back into the inline buffer
+      Relocate(array_, size_, small_buffer_);
+      size_type size = size_;
+      DeleteMemory();
+      array_ = small_buffer_;
+      size_ = size;
+      capacity_ = small_capacity_;
+      return;
+    }
+    ThrowFunction(size_, size_);
     capacity_ = size_;
   };
 
@@ -169,74 +197,173 @@ class Vector {
   };
 
   iterator insert(iterator pos, const_reference value) {
-    if (pos >= end()) {
+    return insert(pos, 1, value);
+  };
+
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // inserts count copies of value before pos
+  iterator insert(iterator pos, size_type count, const_reference value) {
+    if (!Contains(pos)) {
       return pos;
     }
-    if (size_ == capacity_) {
-      pos = InsertReverse(pos, value);
+    size_type index = pos.value - array_;
+    // value may be an element of this vector, and trivially copyable
+    // elements are shifted before the gap is filled
+    std::conditional_t<std::is_trivially_copyable_v<value_type>, value_type,
+                       const_reference>
+        source(value);
+    return iterator(InsertN(index, count, [&](pointer dst) {
+      if constexpr (std::is_trivially_copyable_v<value_type>) {
+        std::uninitialized_fill_n(dst, count, source);
+        return;
+      }
+      size_type i = 0;
+      try {
+        for (; i < count; ++i) {
+          std::allocator_traits<Alloc>::construct(alloc, dst + i, source);
+        }
+      } catch (...) {
+        DestroyRange(dst, dst + i);
+        throw;
+      }
+    }));
+  }
+
+  // inserts the elements of [first, last) before pos; the range must not
+  // point into this vector
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
+    if (!Contains(pos)) {
       return pos;
     }
-    size_++;
-    ConstructDestroy(size_, value_type());
-    auto iter = this->end();
-    iter--;
-    for (; iter > pos; iter--) {
-      iter--;
-      auto it = std::move_if_noexcept(*iter);
-      iter++;
-      *iter = std::move_if_noexcept(it);
-    }
-    *pos = value;
-    return pos;
-  };
+    size_type index = pos.value - array_;
+    using category =
+        typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (!std::is_base_of_v<std::forward_iterator_tag, category>) {
+      Vector items;
+      for (; first != last; ++first) {
+        items.push_back(*first);
+      }
+      return insert(pos, std::make_move_iterator(items.array_),
+                    std::make_move_iterator(items.array_ + items.size_));
+    } else {
+      size_type count = std::distance(first, last);
+      return iterator(InsertN(index, count, [&](pointer dst) {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+          std::uninitialized_copy_n(first, count, dst);
+          return;
+        }
+        size_type i = 0;
+        try {
+          for (InputIt it = first; i < count; ++it, ++i) {
+            std::allocator_traits<Alloc>::construct(alloc, dst + i, *it);
+          }
+        } catch (...) {
+          DestroyRange(dst, dst + i);
+          throw;
+        }
+      }));
+    }
+  }
 
   iterator erase(iterator pos) {
     if (pos >= this->end() || pos < this->begin()) {
       return pos;
     }
-    auto it = end();
-    it--;
-    for (auto iter = pos; iter < it; iter++) {
-      iter++;
-      auto it = std::move_if_noexcept(*iter);
-      iter--;
-      *iter = std::move_if_noexcept(it);
-    }
-    size_--;
-    return pos;
+    return erase(pos, iterator(pos.value + 1));
   };
 
-  void push_back(const_reference value) {
-    if (capacity_ == 0) {
-      size_++;
-      capacity_++;
-      AllocateMemory();
-      ConstructDestroy(0, value);
-      return;
+  // removes [first, last), shifting the tail left in one pass
+  iterator erase(iterator first, iterator last) {
+    if (!Contains(first) || !Contains(last) || !(first < last)) {
+      return first;
     }
-    if (size_ == capacity_) {
-      reserve(capacity_ * 2);
+    pointer from = first.value;
+    pointer to = last.value;
+    pointer old_end = array_ + size_;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      std::memmove(static_cast<void *>(from), to,
+                   (old_end - to) * sizeof(value_type));
+    } else {
+      std::move(to, old_end, from);
+      DestroyRange(old_end - (to - from), old_end);
     }
-    ConstructDestroy(size_, value);
-    size_++;
-  };
+    size_ -= to - from;
+    return first;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); };
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // constructs an element in place at the end
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *InsertN(size_, 1, [&](pointer dst) {
+      std::allocator_traits<Alloc>::construct(alloc, dst,
+                                              std::forward<Args>(args)...);
+    });
+  }
+
+  // constructs an element in place before pos
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args) {
+    if (!Contains(pos)) {
+      return pos;
+    }
+    size_type index = pos.value - array_;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      // args may refer to an element that the memmove is about to shift
+      value_type value(std::forward<Args>(args)...);
+      return iterator(InsertN(index, 1, [&](pointer dst) {
+        std::allocator_traits<Alloc>::construct(alloc, dst, value);
+      }));
+    } else {
+      return iterator(InsertN(index, 1, [&](pointer dst) {
+        std::allocator_traits<Alloc>::construct(alloc, dst,
+                                                std::forward<Args>(args)...);
+      }));
+    }
+  }
 
   void pop_back() {
     if (size_ < 1) {
       return;
-    } else if (size_ == 1) {
-      std::allocator_traits<Alloc>::destroy(alloc, array_);
-    } else {
-      std::allocator_traits<Alloc>::destroy(alloc, array_ + size_);
-      size_ = size_ - 1;
     }
+    size_ = size_ - 1;
+    std::allocator_traits<Alloc>::destroy(alloc, array_ + size_);
   };
 
-  void swap(Vector &other) noexcept {
-    std::swap(alloc, other.alloc);
+  // Heap buffers are exchanged by pointer. An inline buffer cannot change
+  // owner, so then both sides first grow to fit the other's elements and the
+  // elements themselves are swapped.
+  void swap(Vector &other) {
+    if (this == &other) {
+      return;
+    }
+    if (IsSmall() || other.IsSmall()) {
+      reserve(other.size_);
+      other.reserve(size_);
+    }
+    if (!IsSmall() && !other.IsSmall()) {
+      std::swap(alloc, other.alloc);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(array_, other.array_);
+      return;
+    }
+    Vector &longer = size_ < other.size_ ? other : *this;
+    Vector &shorter = size_ < other.size_ ? *this : other;
+    size_type common = shorter.size_;
+    std::swap_ranges(array_, array_ + common, other.array_);
+    shorter.Relocate(longer.array_ + common, longer.size_ - common,
+                     shorter.array_ + common);
+    longer.DestroyRange(longer.array_ + common, longer.array_ + longer.size_);
     std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
-    std::swap(array_, other.array_);
   };
 
   void resize(size_type n) {
@@ -252,11 +379,71 @@ class Vector {
     }
   };
 
+ protected:
+  // Starts empty on storage the vector does not own; used by SmallVector to
+  // hand in its inline buffer. The buffer is reused whenever the elements fit.
+  Vector(pointer buffer, size_type capacity) noexcept
+      : alloc(),
+        array_(buffer),
+        size_(0),
+        capacity_(capacity),
+        small_buffer_(buffer),
+        small_capacity_(capacity) {}
+
+  bool IsSmall() const noexcept {
+    return small_buffer_ != nullptr && array_ == small_buffer_;
+  }
+
+  // Takes over the elements of v; this must not hold any elements or heap
+  // memory. v is left empty on its own inline buffer, if it has one.
+  void TakeStorage(Vector &&v) {
+    if (!v.IsSmall()) {
+      if (v.array_ == nullptr) {
+        return;
+      }
+      array_ = v.array_;
+      size_ = v.size_;
+      capacity_ = v.capacity_;
+      v.array_ = v.small_buffer_;
+      v.size_ = 0;
+      v.capacity_ = v.small_capacity_;
+      return;
+    }
+    if (v.size_ > capacity_) {
+      capacity_ = v.size_;
+      AllocateMemory();
+    }
+    try {
+      Relocate(v.array_, v.size_, array_);
+    } catch (...) {
+      // v keeps its elements; *this is left empty
+      if (array_ != small_buffer_) {
+        std::allocator_traits<Alloc>::deallocate(alloc, array_, capacity_);
+      }
+      array_ = small_buffer_;
+      capacity_ = small_capacity_;
+      throw;
+    }
+    v.DestroyRange(v.array_, v.array_ + v.size_);
+    size_ = v.size_;
+    v.size_ = 0;
+  }
+
+  // Destroys the elements and falls back to the inline buffer, if any.
+  void ResetStorage() noexcept {
+    DeleteMemory();
+    array_ = small_buffer_;
+    size_ = 0;
+    capacity_ = small_capacity_;
+  }
+
  private:
   Alloc alloc;
   pointer array_;
   size_type size_;
   size_type capacity_;
+  pointer small_buffer_ = nullptr;
+  size_type small_capacity_ = 0;
 
   void AllocateMemory() {
     array_ = std::allocator_traits<Alloc>::allocate(alloc, capacity_);
@@ -266,65 +453,114 @@ class Vector {
     for (size_type i = 0; i < size_; ++i) {
       std::allocator_traits<Alloc>::destroy(alloc, array_ + i);
     }
-    std::allocator_traits<Alloc>::deallocate(alloc, array_, capacity_);
+    if (array_ != small_buffer_) {
+      std::allocator_traits<Alloc>::deallocate(alloc, array_, capacity_);
+    }
     array_ = nullptr;
   }
 
+  // Moves the first size elements into a new buffer of cap slots; if a move
+  // throws the vector is left untouched.
   void ThrowFunction(size_type size, size_type cap) {
     pointer new_array = std::allocator_traits<Alloc>::allocate(alloc, cap);
-    size_type i = 0;
     try {
-      if (size_ == 0) {
-        std::allocator_traits<Alloc>::construct(
-            alloc, std::addressof(*(new_array + i)), T());
-      }
-      for (; i < size; ++i) {
-        std::allocator_traits<Alloc>::construct(
-            alloc, std::addressof(*(new_array + i)),
-            std::move_if_noexcept(array_[i]));
-      }
+      Relocate(array_, size, new_array);
     } catch (...) {
-      for (; i < size; ++i) {
-        std::allocator_traits<Alloc>::destroy(alloc, new_array + i);
-      }
       std::allocator_traits<Alloc>::deallocate(alloc, new_array, cap);
       throw;
     }
-    for (size_type i = 0; i < size; ++i) {
-      std::allocator_traits<Alloc>::destroy(alloc, array_ + i);
+    DestroyRange(array_, array_ + size);
+    if (array_ != nullptr && array_ != small_buffer_) {
+      std::allocator_traits<Alloc>::deallocate(alloc, array_, capacity_);
     }
-    std::allocator_traits<Alloc>::deallocate(alloc, array_, cap);
     array_ = new_array;
   }
 
-  iterator InsertReverse(iterator pos, const_reference value) {
-    auto iter = begin();
-    size_type index = 0;
-    for (size_type i = 0; i < size_; i++) {
-      if (iter == pos) {
-        index = i;
+  bool Contains(iterator pos) const noexcept {
+    return pos.value >= array_ && pos.value <= array_ + size_;
+  }
+
+  void DestroyRange(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) {
+      std::allocator_traits<Alloc>::destroy(alloc, first);
+    }
+  }
+
+  // Moves the n elements at src into raw memory at dst.
+  void Relocate(pointer src, size_type n, pointer dst) {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (n != 0) {
+        std::memcpy(static_cast<void *>(dst), src, n * sizeof(value_type));
       }
-      iter++;
-    }
-    reserve(capacity_ * 2);
-    size_++;
-    ConstructDestroy(size_, value_type());
-    size_type i = size_;
-    for (; i != index; i--) {
-      i--;
-      auto it = std::move_if_noexcept(array_[i]);
-      i++;
-      array_[i] = std::move_if_noexcept(it);
-    }
-    size_t j = 0;
-    for (auto iter = begin(); iter < end(); ++iter) {
-      if (j == i) {
-        pos = iter;
+    } else {
+      size_type i = 0;
+      try {
+        for (; i < n; ++i) {
+          std::allocator_traits<Alloc>::construct(
+              alloc, dst + i, std::move_if_noexcept(src[i]));
+        }
+      } catch (...) {
+        DestroyRange(dst, dst + i);
+        throw;
       }
-      j++;
     }
-    array_[i] = value;
-    return pos;
+  }
+
+  // Opens a gap of count slots before index and fills it with
+  // construct(gap), which builds count elements in raw memory and cleans up
+  // after itself on failure. Without reallocation the tail is moved by a
+  // single memmove for trivially copyable types and by a rotation otherwise.
+  // Grows geometrically; if reallocation throws the vector is unchanged.
+  template <typename Construct>
+  pointer InsertN(size_type index, size_type count, Construct construct) {
+    if (count == 0) {
+      return array_ + index;
+    }
+    if (size_ + count > capacity_) {
+      size_type new_cap = std::max(size_ + count, capacity_ * 2);
+      pointer new_array =
+          std::allocator_traits<Alloc>::allocate(alloc, new_cap);
+      try {
+        construct(new_array + index);
+        try {
+          Relocate(array_, index, new_array);
+          try {
+            Relocate(array_ + index, size_ - index, new_array + index + count);
+          } catch (...) {
+            DestroyRange(new_array, new_array + index);
+            throw;
+          }
+        } catch (...) {
+          DestroyRange(new_array + index, new_array + index + count);
+          throw;
+        }
+      } catch (...) {
+        std::allocator_traits<Alloc>::deallocate(alloc, new_array, new_cap);
+        throw;
+      }
+      size_type new_size = size_ + count;
+      DeleteMemory();
+      array_ = new_array;
+      size_ = new_size;
+      capacity_ = new_cap;
+    } else if constexpr (std::is_trivially_copyable_v<value_type>) {
+      pointer gap = array_ + index;
+      size_type tail = (size_ - index) * sizeof(value_type);
+      std::memmove(static_cast<void *>(gap + count), gap, tail);
+      try {
+        construct(gap);
+      } catch (...) {
+        std::memmove(static_cast<void *>(gap), gap + count, tail);
+        throw;
+      }
+      size_ += count;
+    } else {
+      construct(array_ + size_);
+      size_type old_size = size_;
+      size_ += count;
+      std::rotate(array_ + index, array_ + old_size, array_ + size_);
+    }
+    return array_ + index;
   }
 
   void ConstructDestroy(size_type shift, const_reference value) {
@@ -342,7 +578,10 @@ class Vector {
 template <typename T, bool IsConst>
 class CommonIterator {
  public:
-  friend class Vector<T>;
+  template <typename U, typename A>
+  friend class Vector;
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
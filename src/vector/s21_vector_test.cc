@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -257,6 +261,124 @@ TEST(TestVectorInsert, InsertSeventh) {
   ASSERT_EQ(V2.at(4), V.at(4));
 }
 
+TEST(TestVectorInsert, InsertCount) {
+  s21::Vector<int> V = {1, 2, 3};
+  auto it = V.insert(V.begin(), 0, 9);
+  EXPECT_EQ(*it, 1);
+  std::vector<int> V2 = {1, 2, 3};
+  auto start = V.begin();
+  start++;
+  it = V.insert(start, 4, 7);
+  V2.insert(V2.begin() + 1, 4, 7);
+  ASSERT_EQ(V.size(), V2.size());
+  EXPECT_EQ(*it, 7);
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+}
+
+TEST(TestVectorInsert, InsertCountOwnElement) {
+  s21::Vector<int> V = {1, 2, 3};
+  V.reserve(10);
+  V.insert(V.begin(), 2, V.at(2));
+  std::vector<int> V2 = {3, 3, 1, 2, 3};
+  ASSERT_EQ(V.size(), V2.size());
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+}
+
+TEST(TestVectorInsert, InsertRange) {
+  s21::Vector<std::string> V = {"a", "e"};
+  std::vector<std::string> items = {"b", "c", "d"};
+  auto pos = V.begin();
+  pos++;
+  auto it = V.insert(pos, items.begin(), items.end());
+  EXPECT_EQ(*it, "b");
+  std::vector<std::string> V2 = {"a", "b", "c", "d", "e"};
+  ASSERT_EQ(V.size(), V2.size());
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+  V.insert(V.end(), items.begin(), items.begin());
+  EXPECT_EQ(V.size(), 5u);
+}
+
+TEST(TestVectorInsert, InsertRangeWithoutReallocation) {
+  s21::Vector<std::string> V = {"a", "b", "f"};
+  V.reserve(10);
+  std::vector<std::string> items = {"c", "d", "e"};
+  auto pos = V.begin();
+  pos++;
+  pos++;
+  V.insert(pos, items.begin(), items.end());
+  EXPECT_EQ(V.capacity(), 10u);
+  std::vector<std::string> V2 = {"a", "b", "c", "d", "e", "f"};
+  ASSERT_EQ(V.size(), V2.size());
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+}
+
+TEST(TestVectorInsert, InsertRangeFromVector) {
+  s21::Vector<int> V = {1, 5};
+  s21::Vector<int> items = {2, 3, 4};
+  auto pos = V.begin();
+  pos++;
+  V.insert(pos, items.begin(), items.end());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(V.at(i), i + 1);
+  }
+}
+
+TEST(TestVectorInsert, InsertRangeFromInputIterator) {
+  std::istringstream stream("3 4 5");
+  s21::Vector<int> V = {1, 2};
+  V.insert(V.end(), std::istream_iterator<int>(stream),
+           std::istream_iterator<int>());
+  ASSERT_EQ(V.size(), 5u);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(V.at(i), i + 1);
+  }
+}
+
+TEST(TestVectorInsert, InsertGrowsGeometrically) {
+  s21::Vector<int> V = {1, 2, 3, 4};
+  V.insert(V.end(), 1, 5);
+  EXPECT_EQ(V.capacity(), 8u);
+  V.insert(V.end(), 10, 6);
+  EXPECT_EQ(V.capacity(), 16u);
+  EXPECT_EQ(V.size(), 15u);
+}
+
+namespace {
+struct ThrowingCopy {
+  static int copies_left;
+  int value;
+  ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+  ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+};
+int ThrowingCopy::copies_left = -1;
+}  // namespace
+
+TEST(TestVectorInsert, InsertThrowingCopyKeepsVector) {
+  s21::Vector<ThrowingCopy> V = {1, 2, 3};
+  size_t capacity = V.capacity();
+  ThrowingCopy::copies_left = 2;
+  EXPECT_THROW(V.insert(V.begin(), 5, ThrowingCopy(9)), std::runtime_error);
+  ThrowingCopy::copies_left = -1;
+  EXPECT_EQ(V.size(), 3u);
+  EXPECT_EQ(V.capacity(), capacity);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(V.at(i).value, i + 1);
+  }
+}
+
 TEST(TestVectorShrinkToFit, ShrinkToFitFirst) {
   s21::Vector<int> V;
   V.resize(100);
@@ -600,6 +722,35 @@ TEST(TestVectorErase, EraseSeventh) {
   ASSERT_EQ(*iter, *it);
 }
 
+TEST(TestVectorErase, EraseRange) {
+  s21::Vector<std::string> V = {"a", "b", "c", "d", "e"};
+  auto first = V.begin();
+  first++;
+  auto last = first;
+  last++;
+  last++;
+  auto it = V.erase(first, last);
+  EXPECT_EQ(*it, "d");
+  std::vector<std::string> V2 = {"a", "d", "e"};
+  ASSERT_EQ(V.size(), V2.size());
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+}
+
+TEST(TestVectorErase, EraseRangeTrivial) {
+  s21::Vector<int> V = {1, 2, 3, 4, 5};
+  auto first = V.begin();
+  first++;
+  V.erase(first, first);
+  EXPECT_EQ(V.size(), 5u);
+  V.erase(first, V.end());
+  ASSERT_EQ(V.size(), 1u);
+  EXPECT_EQ(V.at(0), 1);
+  V.erase(V.begin(), V.end());
+  EXPECT_EQ(V.size(), 0u);
+}
+
 TEST(TestVectorFront, Front) {
   s21::Vector<int> V = {1, 2, 3};
   auto result_1 = V.front();
@@ -1259,3 +1410,66 @@ TEST(TestVectorIteratorConst, IteratorConstThirteenth) {
   iter2++;
   ASSERT_EQ(it >= it2, iter >= iter2);
 }
+
+TEST(TestVectorEmplace, EmplaceBackInPlace) {
+  s21::Vector<std::pair<int, std::string>> V;
+  auto &ref = V.emplace_back(1, "one");
+  ASSERT_EQ(&ref, &V[0]);
+  V.emplace_back(2, std::string(3, 'x'));
+  ASSERT_EQ(V[0].second, "one");
+  ASSERT_EQ(V[1].second, "xxx");
+  ASSERT_EQ(V.size(), 2u);
+}
+
+TEST(TestVectorEmplace, EmplaceMiddle) {
+  s21::Vector<std::string> V = {"a", "c"};
+  auto pos = V.begin();
+  pos++;
+  auto it = V.emplace(pos, 2, 'b');
+  ASSERT_EQ(*it, "bb");
+  std::vector<std::string> V2 = {"a", "bb", "c"};
+  ASSERT_EQ(V.size(), V2.size());
+  for (size_t i = 0; i < V2.size(); ++i) {
+    EXPECT_EQ(V.at(i), V2.at(i));
+  }
+}
+
+TEST(TestVectorEmplace, MoveOnly) {
+  s21::Vector<std::unique_ptr<int>> V;
+  for (int i = 1; i <= 20; ++i) {
+    V.push_back(std::make_unique<int>(i));
+  }
+  V.emplace(V.begin(), std::make_unique<int>(0));
+  auto pos = V.begin();
+  for (int i = 0; i < 5; ++i) {
+    pos++;
+  }
+  V.insert(pos, std::make_unique<int>(-1));
+  ASSERT_EQ(V.size(), 22u);
+  ASSERT_EQ(*V[0], 0);
+  ASSERT_EQ(*V[5], -1);
+  ASSERT_EQ(*V[21], 20);
+}
+
+TEST(TestVectorEmplace, PushBackRvalueMoves) {
+  s21::Vector<std::string> V;
+  std::string value(100, 'a');
+  V.push_back(std::move(value));
+  ASSERT_EQ(V[0], std::string(100, 'a'));
+  ASSERT_TRUE(value.empty());
+}
+
+TEST(TestVectorEmplace, EmplaceOwnElement) {
+  s21::Vector<std::string> V = {"first", "second"};
+  V.shrink_to_fit();
+  V.emplace_back(V[0]);
+  V.emplace(V.begin(), V[2]);
+  ASSERT_EQ(V[0], "first");
+  ASSERT_EQ(V[3], "first");
+  s21::Vector<int> I = {7, 8};
+  I.shrink_to_fit();
+  I.emplace_back(I[0]);
+  I.emplace(I.begin(), I[1]);
+  ASSERT_EQ(I[0], 8);
+  ASSERT_EQ(I[3], 7);
+}